@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "pre_process/utils/PreProcessUtils.hpp"
+
+/**
+ * Times createBlob4D for one batch with the images converted sequentially and on
+ * pools of 1, 2, 4 and 8 threads, as preprocess.preProcessImageThreads does.
+ *
+ * Usage: preprocess_image_threads_bench [batch=16] [srcHeight=720] [srcWidth=1280]
+ *                                       [height=512] [width=1024] [iterations=20]
+ *
+ * Prints the median batch time and the speedup over the sequential run for FP32
+ * and FP16, and checks that every pooled run writes the sequential bytes.
+ */
+
+namespace {
+
+struct BenchConfig {
+    int batch = 16;
+    int srcHeight = 720;
+    int srcWidth = 1280;
+    int height = 512;
+    int width = 1024;
+    int iterations = 20;
+};
+
+template <typename T>
+double medianBatchMs(
+    const BenchConfig& config,
+    const std::vector<cv::Mat>& images,
+    TensorView& tensor,
+    ThreadPool* pool
+) {
+    const std::array<float, 3> means = {0.0f, 0.0f, 0.0f};
+    std::vector<double> samples;
+    samples.reserve(config.iterations);
+
+    // One untimed run warms the per-thread resize buffers and the tensor pages.
+    for (int i = 0; i <= config.iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        createBlob4D<T>(
+            images, config.batch, 3, config.height, config.width,
+            means, 1.0f / 255.0f, true, {}, 0.0f, tensor, pool
+        );
+        const auto stop = std::chrono::steady_clock::now();
+        if (i > 0) {
+            samples.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+    }
+
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+template <typename T>
+void benchType(const char* name, DataType type, const BenchConfig& config, const std::vector<cv::Mat>& images) {
+
+    const size_t elems = static_cast<size_t>(config.batch) * 3 * config.height * config.width;
+    std::vector<T> sequentialOut(elems);
+    std::vector<T> pooledOut(elems);
+
+    const auto viewOf = [&](std::vector<T>& storage) {
+        TensorView view;
+        view.data = storage.data();
+        view.type = type;
+        view.numElements = storage.size();
+        view.totalBytes = storage.size() * sizeof(T);
+        view.shape.dims = {
+            static_cast<size_t>(config.batch), 3,
+            static_cast<size_t>(config.height), static_cast<size_t>(config.width)
+        };
+        view.mode = IOMode::Input;
+        view.device = DeviceType::CPU;
+        return view;
+    };
+
+    TensorView sequentialView = viewOf(sequentialOut);
+    const double sequentialMs = medianBatchMs<T>(config, images, sequentialView, nullptr);
+    std::printf("%-5s sequential       %8.2f ms/batch\n", name, sequentialMs);
+
+    for (size_t threads : {1, 2, 4, 8}) {
+        ThreadPool pool(threads);
+        TensorView pooledView = viewOf(pooledOut);
+        const double pooledMs = medianBatchMs<T>(config, images, pooledView, &pool);
+        const bool identical = std::memcmp(pooledOut.data(), sequentialOut.data(), elems * sizeof(T)) == 0;
+
+        std::printf(
+            "%-5s %zu thread(s)      %8.2f ms/batch  %5.2fx%s\n",
+            name, threads, pooledMs, sequentialMs / pooledMs, identical ? "" : "  OUTPUT DIFFERS"
+        );
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char** argv) {
+
+    BenchConfig config;
+    int* const fields[] = {
+        &config.batch, &config.srcHeight, &config.srcWidth, &config.height, &config.width, &config.iterations
+    };
+    for (int i = 1; i < argc && i <= static_cast<int>(std::size(fields)); ++i) {
+        *fields[i - 1] = std::max(1, std::atoi(argv[i]));
+    }
+
+    std::vector<cv::Mat> images;
+    cv::RNG rng(42);
+    for (int i = 0; i < config.batch; ++i) {
+        cv::Mat image(config.srcHeight, config.srcWidth, CV_8UC3);
+        rng.fill(image, cv::RNG::UNIFORM, cv::Scalar::all(0), cv::Scalar::all(256));
+        images.push_back(image);
+    }
+
+    std::printf(
+        "batch %d, %dx%d -> %dx%d, %d iterations, %u hardware threads, AVX2 %s\n",
+        config.batch, config.srcWidth, config.srcHeight, config.width, config.height,
+        config.iterations, std::thread::hardware_concurrency(), preProcessAvx2Active() ? "on" : "off"
+    );
+
+    benchType<float>("fp32", DataType::Float32, config, images);
+    benchType<cv::float16_t>("fp16", DataType::Float16, config, images);
+    return 0;
+}
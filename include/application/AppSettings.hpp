@@ -3,7 +3,9 @@
 #include <filesystem>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "application/utils/enums.hpp"
 #include "backends/utils/enums.hpp"
 #include "core/enums.hpp"
 #include "core/tensor.hpp"
@@ -21,6 +23,7 @@ namespace fs = std::filesystem;
 struct StaticSettings {
     static constexpr const char* DEFAULT_LOG_FILE = "main.log";
     static constexpr LoggingSeverityType DEFAULT_LOG_SEVERITY = LoggingSeverityType::INFO;
+    static constexpr size_t DEFAULT_LOG_ASYNC_QUEUE_CAPACITY = 8192;
     static constexpr size_t NUM_IMG_CHANNELS = 3;
 };
 
@@ -33,9 +36,11 @@ struct StaticSettings {
  */
 struct AppSettings {
 
-    /** @brief Log file path and minimum severity. */
+    /** @brief Log file path, minimum severity, and write mode. */
     fs::path logFilePath = StaticSettings::DEFAULT_LOG_FILE;
     LoggingSeverityType loggingSeverity = StaticSettings::DEFAULT_LOG_SEVERITY;
+    LoggingMode loggingMode = LoggingMode::SYNC;
+    size_t loggingAsyncQueueCapacity = StaticSettings::DEFAULT_LOG_ASYNC_QUEUE_CAPACITY;
 
     /** @brief Frame source selection and source image geometry. */
     FrameSourceType frameSourceType = FrameSourceType::FOLDER;
@@ -43,14 +48,39 @@ struct AppSettings {
     size_t origImgHeight = 0;
     size_t origImgWidth = 0;
     size_t batchSize = 1;
+    size_t decodeThreads = 0;
+    size_t readAheadFrames = 0;
+    bool reducedDecode = false;
+    FileReadMode fileReadMode = FileReadMode::READ;
+    size_t prefetchFiles = 0;
+    size_t framePoolSize = 0;
+    size_t startOffset = 0;
+    size_t endOffset = 0;
+    SyntheticPattern syntheticPattern = SyntheticPattern::SHAPES;
+    size_t syntheticFrameCount = 0;
+    double syntheticFps = 0.0;
+    size_t sharedMemoryTimeoutMs = 0;
+    size_t videoFrameStride = 1;
+    double videoTargetFps = 0.0;
+    size_t videoStartMs = 0;
+    size_t videoEndMs = 0;
+    size_t videoDecodeSegments = 0;
+    size_t videoSegmentFrames = 128;
 
     /** @brief Preprocessing options used before inference. */
     ChannelOrderType imgChannelOrdering = ChannelOrderType::BGR;
     size_t imgPreProcessedImgH = 0;
     size_t imgPreProcessedImgW = 0;
     DataType preprocessedDataType = DataType::Float32;
+    TensorLayoutType imgTensorLayout = TensorLayoutType::NCHW;
     float imgPreProcessScalingFactor = 1.0f;
     float imgPreProcessMeanFactor = 0.0f;
+    std::vector<float> imgPreProcessChannelMeans;
+    float imgQuantizationScale = 0.0f;
+    int imgQuantizationZeroPoint = 0;
+    ResizeModeType imgResizeMode = ResizeModeType::STRETCH;
+    float imgLetterboxPadValue = 114.0f;
+    size_t preProcessImageThreads = 0;
     PreferredProcessingDevice preferredDevicePreProc = PreferredProcessingDevice::PREFER_CPU;
     std::unordered_map<std::string, int> ndimsOfInputs;
 
@@ -59,11 +89,21 @@ struct AppSettings {
     ModelType modelType = ModelType::UNSET;
     PreferredProcessingDevice preferredInferenceDevice = PreferredProcessingDevice::PREFER_GPU;
     fs::path serializedModelPath;
+    size_t numCpuNetworkInstances = 1;
+    fs::path captureOutputPath;
+    bool replayLoop = true;
+    uint64_t replayStartFrame = 0;
+    uint64_t mockFixedLatencyUs = 0;
+    uint64_t mockPerItemLatencyUs = 0;
+    uint64_t mockLatencyJitterUs = 0;
+    size_t mockDetectionsPerFrame = 10;
+    uint64_t mockSeed = 0;
 
     /** @brief Tensor groups and model IO tensor specifications. */
     TensorGroupList preProcessingTensorGroups;
     TensorGroupList inferenceTensorGroups;
     TensorGroupList postProcessingTensorGroups;
+    size_t numTensorSlots = 1;
     TensorSpecMap inputTensorSpecs;
     TensorSpecMap outputTensorSpecs;
 
@@ -82,4 +122,27 @@ struct AppSettings {
     DrawDetectionMode drawDetMode = DrawDetectionMode::UNSET;
     int lineThickness = 1;
     fs::path resultsDir;
+
+    /** @brief Execution mode and pipelined stage workers/queue depths. */
+    ExecutionMode executionMode = ExecutionMode::SERIAL;
+    size_t preProcessThreads = 1;
+    size_t postProcessThreads = 1;
+    size_t preProcessQueueDepth = 2;
+    size_t inferenceQueueDepth = 2;
+    size_t postProcessQueueDepth = 2;
+    size_t sinkQueueDepth = 2;
+    size_t queueReportInterval = 0;
+
+    /** @brief Per-stage latency histograms, periodic report interval, and JSON report path. */
+    bool stageStatsEnabled = true;
+    size_t stageStatsReportInterval = 0;
+    fs::path stageStatsJsonPath;
+
+    /** @brief Chrome trace output path (empty disables tracing) and per-thread span capacity. */
+    fs::path traceOutputPath;
+    size_t traceEventsPerThread = 65536;
+
+    /** @brief Prometheus textfile path (empty disables export) and rewrite interval. */
+    fs::path metricsTextfilePath;
+    size_t metricsExportIntervalMs = 5000;
 };
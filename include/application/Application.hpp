@@ -3,8 +3,13 @@
 #include <filesystem>
 
 #include "AppSettings.hpp"
+#include "application/PipelineExecutor.hpp"
 #include "source/config/FrameSourceConfig.hpp"
 #include "backends/config/InferenceBackendConfig.hpp"
+#include "backends/utils/InferenceCapture.hpp"
+#include "instrumentation/MetricsExporter.hpp"
+#include "instrumentation/StageStatistics.hpp"
+#include "instrumentation/TraceRecorder.hpp"
 #include "logging/BaseLogger.hpp"
 #include "memory_management/MemoryManager.hpp"
 #include "pre_process/config/PreProcessorConfig.hpp"
@@ -40,11 +45,23 @@ class Application {
          * @brief Execute the full source -> preprocess -> inference -> postprocess -> sink loop.
          *
          * The loop processes full batches from the configured FrameSource and logs
-         * aggregate throughput when the source is exhausted.
+         * aggregate throughput when the source is exhausted. Depending on
+         * `execution.executionMode`, stages run serially on the calling thread or
+         * overlapped on worker threads through PipelineExecutor.
          */
         void run();
 
     private:
+        /**
+         * @brief Run every stage for one batch at a time on the calling thread.
+         */
+        PipelineRunStats runSerial();
+
+        /**
+         * @brief Run stages concurrently through PipelineExecutor.
+         */
+        PipelineRunStats runPipelined();
+
         /**
          * @brief Build the application from already parsed settings.
          * @param settings Complete application settings.
@@ -59,5 +76,9 @@ class Application {
         std::unique_ptr<InferenceBackend> m_inferBackend;
         std::unique_ptr<PostProcessor> m_postProcessor;
         std::unique_ptr<ResultSink> m_resultSink;
+        std::unique_ptr<InferenceCaptureWriter> m_captureWriter;
+        std::unique_ptr<StageStatistics> m_stageStats;
+        std::unique_ptr<TraceRecorder> m_traceRecorder;
+        std::unique_ptr<MetricsTextfileExporter> m_metricsExporter;
         BatchFrameData m_currBatch;
 };
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "application/config/PipelineExecutorConfig.hpp"
+#include "application/utils/SpscQueue.hpp"
+#include "backends/interface/InferenceBackend.hpp"
+#include "backends/utils/InferenceCapture.hpp"
+#include "instrumentation/MetricsRegistry.hpp"
+#include "instrumentation/StageStatistics.hpp"
+#include "instrumentation/TraceRecorder.hpp"
+#include "logging/BaseLogger.hpp"
+#include "memory_management/MemoryManager.hpp"
+#include "post_process/interface/PostProcessor.hpp"
+#include "pre_process/interface/PreProcessor.hpp"
+#include "sinks/interface/ResultSink.hpp"
+#include "source/interface/FrameSource.hpp"
+
+/**
+ * @brief Aggregate counters produced by one complete application run.
+ */
+struct PipelineRunStats {
+    size_t totalSourceFrames = 0;
+    size_t totalBatches = 0;
+};
+
+/**
+ * @brief Unit of work passed between pipeline stages.
+ */
+struct PipelineBatch {
+    /** Zero-based batch sequence number assigned by the read stage. */
+    size_t sequence = 0;
+    /** Source images and metadata for the batch. */
+    BatchFrameData frames;
+    /** Postprocess results, filled by the postprocess stage. */
+    std::vector<PostProcessOutput> outputs;
+};
+
+/**
+ * @brief Multi-threaded staged executor for the source -> sink pipeline.
+ *
+ * Stages run on dedicated workers connected by bounded lock-free SPSC queues:
+ *
+ * - read (1 worker): FrameSource::readBatch() and metadata stamping,
+ * - preprocess (N workers): PreProcessor::process() into pipeline tensors,
+ * - inference (1 worker): host/device transfers and InferenceBackend::runInference(),
+ * - postprocess (N workers): PostProcessor::process(),
+ * - sink (1 worker): ResultSink::consumeBatch() in batch order.
+ *
+ * Batch `seq` is always handled by worker `seq % N` of a stage, so every
+ * producer/consumer worker pair gets its own SPSC queue and each consumer pops
+ * its batches in sequence order. This keeps results ordered at the sink without
+ * a reorder buffer. Pipeline tensors come from MemoryManager's slot ring:
+ * batch `seq` acquires slot `seq % K` before preprocessing and releases it
+ * after postprocessing, so up to K batches are in flight between those stages.
+ */
+class PipelineExecutor {
+
+    public:
+        /**
+         * @brief Construct an executor over already built application components.
+         * @param config Stage thread counts, queue depths, and metadata settings.
+         * @param captureWriter Optional sink for host inference outputs, written by the inference stage.
+         * @param stageStats Optional per-stage latency statistics recorded by every worker.
+         * @param traceRecorder Optional span recorder; every worker names its thread and traces its batches.
+         * @throws std::runtime_error for zero thread counts or queue depths.
+         */
+        PipelineExecutor(
+            const PipelineExecutorConfig& config,
+            FrameSource& frameSource,
+            PreProcessor& preProcessor,
+            InferenceBackend& inferBackend,
+            PostProcessor& postProcessor,
+            ResultSink& resultSink,
+            MemoryManager& memManager,
+            BaseLogger& logger,
+            InferenceCaptureWriter* captureWriter = nullptr,
+            StageStatistics* stageStats = nullptr,
+            TraceRecorder* traceRecorder = nullptr
+        );
+
+        /**
+         * @brief Run all stages until the frame source is exhausted.
+         * @return Frame and batch totals consumed by the sink.
+         * @throws The first exception raised by any stage worker.
+         */
+        PipelineRunStats run();
+
+    private:
+        /**
+         * @brief SPSC queues connecting every worker of one stage to every worker of the next.
+         */
+        class StageLink {
+
+            public:
+                StageLink(std::string name, size_t producers, size_t consumers, size_t depth);
+
+                /**
+                 * @brief Push a batch to the queue selected by its sequence number.
+                 * @return false when the executor is stopping.
+                 */
+                bool push(PipelineBatch& batch, const std::atomic<bool>& stop);
+
+                /**
+                 * @brief Pop the batch with the given sequence number.
+                 * @return false at end of stream or when the executor is stopping.
+                 */
+                bool pop(
+                    size_t sequence,
+                    PipelineBatch& batch,
+                    const std::atomic<bool>& stop,
+                    const std::atomic<size_t>& totalBatches
+                );
+
+                size_t occupancy() const;
+                size_t capacity() const;
+                const std::string& name() const;
+
+            private:
+                SpscQueue<PipelineBatch>& queueFor(size_t sequence);
+
+                std::string m_name;
+                size_t m_producers, m_consumers;
+                std::vector<std::unique_ptr<SpscQueue<PipelineBatch>>> m_queues;
+        };
+
+        /**
+         * @brief Running occupancy samples for one stage input queue.
+         */
+        struct QueueOccupancy {
+            size_t samples = 0;
+            size_t sum = 0;
+            size_t max = 0;
+            Gauge* depth = nullptr;
+        };
+
+        void readWorker();
+        void preProcessWorker(size_t workerId);
+        void inferenceWorker();
+        void postProcessWorker(size_t workerId);
+        void sinkWorker();
+
+        void sampleQueueOccupancy();
+        void logQueueOccupancy(const char* label);
+        void fail(std::exception_ptr error);
+
+        PipelineExecutorConfig m_config;
+        FrameSource& m_frameSource;
+        PreProcessor& m_preProcessor;
+        InferenceBackend& m_inferBackend;
+        PostProcessor& m_postProcessor;
+        ResultSink& m_resultSink;
+        BaseLogger& m_logger;
+        InferenceCaptureWriter* m_captureWriter;
+        StageStatistics* m_stageStats;
+        TraceRecorder* m_trace;
+
+        std::unique_ptr<PipelineTensorContextRing> m_tensorRing;
+        std::vector<std::string> m_inputKeys;
+        std::vector<std::string> m_outputKeys;
+        int m_cudaDevice = 0;
+
+        StageLink m_toPreProcess;
+        StageLink m_toInference;
+        StageLink m_toPostProcess;
+        StageLink m_toSink;
+        std::vector<QueueOccupancy> m_occupancy;
+        Counter& m_batchesCompleted = MetricsRegistry::global().counter(
+            "yoloseg_pipeline_batches_total", "Batches that completed every pipeline stage."
+        );
+
+        std::atomic<bool> m_stop{false};
+        std::atomic<size_t> m_totalBatches;
+        std::mutex m_errorMutex;
+        std::exception_ptr m_error;
+
+        PipelineRunStats m_stats;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+#include "core/enums.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Configuration for the pipelined (multi-threaded) execution mode.
+ */
+struct PipelineExecutorConfig {
+
+    ///< Frames per batch produced by the frame source.
+    size_t batchSize = 1;
+    ///< Network input geometry and results directory stamped on frame metadata.
+    size_t inputWidth = 0;
+    size_t inputHeight = 0;
+    fs::path resultsDir;
+    ///< Device used by the inference stage; GPU creates a CUDA stream.
+    PreferredProcessingDevice inferenceDevice = PreferredProcessingDevice::PREFER_GPU;
+
+    ///< Worker threads for the stateless preprocessing and postprocessing stages.
+    size_t preProcessThreads = 1;
+    size_t postProcessThreads = 1;
+
+    ///< Bounded queue depth in front of each stage, per producer/consumer worker pair.
+    size_t preProcessQueueDepth = 2;
+    size_t inferenceQueueDepth = 2;
+    size_t postProcessQueueDepth = 2;
+    size_t sinkQueueDepth = 2;
+
+    ///< Log queue occupancy every N completed batches; 0 logs only the final summary.
+    size_t queueReportInterval = 0;
+    ///< Log interval stage latency statistics every N completed batches; 0 disables.
+    size_t statsReportInterval = 0;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Cache line size used to keep producer and consumer indices apart.
+ */
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Progressive wait strategy for lock-free polling loops.
+ *
+ * Spins briefly, then yields, then sleeps so that idle pipeline workers do not
+ * burn a full core while waiting on an empty or full queue.
+ */
+class SpinBackoff {
+
+    public:
+        /**
+         * @brief Wait for a short, increasing amount of time.
+         */
+        void pause() {
+            if (m_spins < SPIN_LIMIT) {
+                ++m_spins;
+            } else if (m_spins < YIELD_LIMIT) {
+                ++m_spins;
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(SLEEP_US));
+            }
+        }
+
+        /**
+         * @brief Restart from the spinning phase after progress was made.
+         */
+        void reset() {
+            m_spins = 0;
+        }
+
+    private:
+        static constexpr size_t SPIN_LIMIT = 64;
+        static constexpr size_t YIELD_LIMIT = 1024;
+        static constexpr int SLEEP_US = 50;
+
+        size_t m_spins = 0;
+};
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer.
+ *
+ * Exactly one thread may call tryPush() and exactly one thread may call
+ * tryPop(). size() may be called from any thread and returns an approximate
+ * occupancy suitable for monitoring.
+ *
+ * @tparam T Default-constructible, move-assignable element type.
+ */
+template <typename T>
+class SpscQueue {
+
+    public:
+        /**
+         * @brief Construct a queue holding at most `capacity` elements.
+         * @param capacity Maximum number of queued elements, at least 1.
+         */
+        explicit SpscQueue(size_t capacity):
+            m_slotCount((capacity == 0 ? 1 : capacity) + 1),
+            m_slots(m_slotCount) {}
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /**
+         * @brief Move an element into the queue if there is space.
+         * @param item Element to enqueue; left moved-from on success.
+         * @return false when the queue is full.
+         */
+        bool tryPush(T& item) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            const size_t next = increment(tail);
+
+            if (next == m_cachedHead) {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (next == m_cachedHead) {
+                    return false;
+                }
+            }
+
+            m_slots[tail] = std::move(item);
+            m_tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Move the oldest element out of the queue if one is available.
+         * @param item Destination element.
+         * @return false when the queue is empty.
+         */
+        bool tryPop(T& item) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head == m_cachedTail) {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail) {
+                    return false;
+                }
+            }
+
+            item = std::move(m_slots[head]);
+            m_head.store(increment(head), std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Approximate number of queued elements.
+         */
+        size_t size() const {
+            const size_t head = m_head.load(std::memory_order_acquire);
+            const size_t tail = m_tail.load(std::memory_order_acquire);
+            return tail >= head ? tail - head : tail + m_slotCount - head;
+        }
+
+        /**
+         * @brief Maximum number of queued elements.
+         */
+        size_t capacity() const {
+            return m_slotCount - 1;
+        }
+
+    private:
+        size_t increment(size_t index) const {
+            return index + 1 == m_slotCount ? 0 : index + 1;
+        }
+
+        const size_t m_slotCount;
+        std::vector<T> m_slots;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0};
+        alignas(CACHE_LINE_SIZE) size_t m_cachedTail = 0;       // consumer-owned
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0};
+        alignas(CACHE_LINE_SIZE) size_t m_cachedHead = 0;       // producer-owned
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+/**
+ * @brief Execution strategy used by Application::run().
+ */
+enum class ExecutionMode {
+    SERIAL,                         // Single thread, one batch at a time
+    PIPELINED                       // One or more workers per stage, connected by bounded queues
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 
 #include "core/enums.hpp"
@@ -19,4 +21,17 @@ struct InferenceBackendConfig {
     PreferredProcessingDevice processDevice;
     ///< Serialized model or engine path.
     fs::path modelFilePath;
+    ///< Independent network instances used by CPU backends to run batch items in parallel.
+    size_t numCpuNetworkInstances = 1;
+    ///< Replay backend: wrap around at the end of the capture instead of failing.
+    bool replayLoop = true;
+    ///< Replay backend: frame id of the first replayed record.
+    uint64_t replayStartFrame = 0;
+    ///< Mock backend: per-batch latency = fixed + batchSize * perItem, +- uniform jitter (microseconds).
+    uint64_t mockFixedLatencyUs = 0;
+    uint64_t mockPerItemLatencyUs = 0;
+    uint64_t mockLatencyJitterUs = 0;
+    ///< Mock backend: synthetic detections written per frame and RNG seed.
+    size_t mockDetectionsPerFrame = 10;
+    uint64_t mockSeed = 0;
 };
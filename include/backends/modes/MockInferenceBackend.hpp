@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include "backends/interface/InferenceBackend.hpp"
+#include "backends/config/InferenceBackendConfig.hpp"
+#include "logging/BaseLogger.hpp"
+
+
+/**
+ * @brief Synthetic inference backend with a configurable latency model.
+ *
+ * runInference() sleeps for
+ *
+ *   mockFixedLatencyUs + batchSize * mockPerItemLatencyUs + U(-mockLatencyJitterUs, +mockLatencyJitterUs)
+ *
+ * and then writes mockDetectionsPerFrame non-overlapping detections per frame
+ * into the modified YOLO segmentation outputs (`boxes`, `masks`, `classlabel`,
+ * `objectness`). Detections and jitter depend only on mockSeed and the number
+ * of frames produced so far, so runs are reproducible. The CPU-side stages can
+ * then be measured against an inference stage of known cost without a model.
+ */
+class MockInferenceBackend : public InferenceBackend {
+
+    public:
+        /**
+         * @brief Construct from latency and detection settings.
+         * @param config Backend configuration with the mock* settings.
+         * @param baseLogger Logger used for configuration diagnostics.
+         */
+        MockInferenceBackend(
+            const InferenceBackendConfig& config,
+            BaseLogger& baseLogger
+        );
+
+        /**
+         * @copydoc InferenceBackend::bindTensorViewMap
+         */
+        void bindTensorViewMap(const TensorViewMap& bufferViews) override;
+
+        /**
+         * @copydoc InferenceBackend::runInference
+         */
+        bool runInference(
+            const TensorViewMap& inputBufferViews,
+            TensorViewMap& outputBufferViews,
+            cudaStream_t stream
+        ) override;
+
+        /**
+         * @copydoc InferenceBackend::getTensorSpecs
+         */
+        TensorSpecMap getTensorSpecs() override;
+
+    private:
+        void writeDetections(TensorViewMap& outputBufferViews, size_t batchSize);
+
+        BaseLogger& m_logger;
+        std::chrono::microseconds m_fixedLatency;
+        std::chrono::microseconds m_perItemLatency;
+        int64_t m_jitterUs = 0;
+        size_t m_detectionsPerFrame = 0;
+        uint64_t m_seed = 0;
+
+        std::mt19937_64 m_jitterRng;
+        uint64_t m_framesProduced = 0;
+        size_t m_inputHeight = 0;
+        size_t m_inputWidth = 0;
+        TensorSpecMap m_boundSpecs;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "backends/interface/InferenceBackend.hpp"
+#include "backends/config/InferenceBackendConfig.hpp"
+#include "backends/utils/InferenceCapture.hpp"
+#include "logging/BaseLogger.hpp"
+
+
+/**
+ * @brief Inference backend that replays output tensors from a capture file.
+ *
+ * Each runInference() call copies the next batchSize frame records of the
+ * memory mapped capture, skipping padding records, straight into the bound host output tensors. No model is
+ * loaded and no GPU is required, so postprocessing, sinks and the application
+ * loop can be profiled with bit-identical inputs on every run.
+ */
+class ReplayInferenceBackend : public InferenceBackend {
+
+    public:
+        /**
+         * @brief Map the capture file named by the config model path.
+         * @param config Backend configuration with capture path, start frame, and loop flag.
+         * @param baseLogger Logger used for replay diagnostics.
+         * @throws std::runtime_error if the capture cannot be opened or holds no frame records.
+         */
+        ReplayInferenceBackend(
+            const InferenceBackendConfig& config,
+            BaseLogger& baseLogger
+        );
+
+        /**
+         * @copydoc InferenceBackend::bindTensorViewMap
+         */
+        void bindTensorViewMap(const TensorViewMap& bufferViews) override;
+
+        /**
+         * @copydoc InferenceBackend::runInference
+         */
+        bool runInference(
+            const TensorViewMap& inputBufferViews,
+            TensorViewMap& outputBufferViews,
+            cudaStream_t stream
+        ) override;
+
+        /**
+         * @copydoc InferenceBackend::getTensorSpecs
+         */
+        TensorSpecMap getTensorSpecs() override;
+
+        /**
+         * @brief Continue replay from the record captured for a frame id.
+         * @throws std::runtime_error when the frame id is not in the capture.
+         */
+        void seek(uint64_t frameId);
+
+    private:
+        /**
+         * @brief Bound host output tensor and its capture table entry.
+         */
+        struct ReplayTensor {
+            TensorView view;
+            const capture::CaptureTensorEntry* entry = nullptr;
+        };
+
+        bool isPaddingRecord(uint64_t record) const;
+
+        /**
+         * @brief Advance the replay position to the next frame record, or the end of the capture.
+         */
+        void skipPaddingRecords();
+
+        BaseLogger& m_logger;
+        InferenceCaptureReader m_reader;
+        std::vector<ReplayTensor> m_outputs;
+        uint64_t m_nextRecord = 0;
+        bool m_loop = true;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opencv2/dnn.hpp>
+
+#include "backends/interface/InferenceBackend.hpp"
+#include "backends/config/InferenceBackendConfig.hpp"
+#include "core/ThreadPool.hpp"
+#include "logging/BaseLogger.hpp"
+
+
+/**
+ * @brief OpenCV DNN CPU inference backend for modified YOLO segmentation ONNX models.
+ *
+ * Loads the ONNX produced by helpers/modify_onnx.py once per network
+ * instance. A batch is split item by item across instances, each running on
+ * its own thread. Float32 and UInt8 inputs are wrapped as cv::Mat headers over
+ * the bound host tensors without copying; every output is copied once from
+ * the network into the bound host tensor.
+ */
+class YoloSegOcvCpuBackend : public InferenceBackend {
+
+    public:
+        /**
+         * @brief Load the ONNX model into the configured number of network instances.
+         * @param config Backend configuration containing the ONNX path and instance count.
+         * @param baseLogger Logger used for load diagnostics.
+         * @throws std::runtime_error if the model cannot be loaded.
+         */
+        YoloSegOcvCpuBackend(
+            const InferenceBackendConfig& config,
+            BaseLogger& baseLogger
+        );
+
+        /**
+         * @copydoc InferenceBackend::bindTensorViewMap
+         */
+        void bindTensorViewMap(const TensorViewMap& bufferViews) override;
+
+        /**
+         * @copydoc InferenceBackend::runInference
+         */
+        bool runInference(
+            const TensorViewMap& inputBufferViews,
+            TensorViewMap& outputBufferViews,
+            cudaStream_t stream
+        ) override;
+
+        /**
+         * @copydoc InferenceBackend::getTensorSpecs
+         *
+         * OpenCV DNN does not expose static IO shapes, so specs are reported
+         * for the host tensors bound so far.
+         */
+        TensorSpecMap getTensorSpecs() override;
+
+    private:
+        /**
+         * @brief Host tensor bound by name, with the element count of one batch item.
+         */
+        struct BoundTensor {
+            std::string name;
+            TensorView view;
+            size_t itemElements = 0;
+        };
+
+        void runItems(size_t instance, size_t batchSize);
+        void runItem(size_t instance, size_t batchIdx);
+
+        BaseLogger& m_logger;
+        std::vector<cv::dnn::Net> m_nets;
+        std::unique_ptr<ThreadPool> m_workers;
+        std::vector<BoundTensor> m_inputs;
+        std::vector<BoundTensor> m_outputs;
+        std::vector<std::string> m_outputNames;
+        std::vector<std::vector<cv::Mat>> m_inputScratch;
+        std::vector<std::vector<cv::Mat>> m_outputBlobs;
+};
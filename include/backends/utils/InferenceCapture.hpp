@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/tensor.hpp"
+#include "source/utils/frame.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief On-disk layout of an inference output capture file.
+ *
+ * All fields are host-endian and the file is designed to be memory-mapped:
+ *
+ *   CaptureFileHeader
+ *   CaptureTensorEntry[numTensors]
+ *   zero padding up to dataOffset (page aligned)
+ *   record[numRecords], each recordBytes long:
+ *       CaptureRecordHeader
+ *       tensor payloads at CaptureTensorEntry::recordOffset
+ *
+ * One record holds the outputs of one batch item, so records are indexed by
+ * the source frame id rather than by batch, and replay works for any batch
+ * size.
+ */
+namespace capture {
+
+inline constexpr char FILE_MAGIC[8] = {'Y', 'S', 'E', 'G', 'C', 'A', 'P', '1'};
+inline constexpr uint32_t FILE_VERSION = 1;
+inline constexpr size_t MAX_TENSOR_NAME = 64;
+inline constexpr size_t MAX_TENSOR_RANK = 8;
+inline constexpr size_t DATA_ALIGNMENT = 4096;
+inline constexpr size_t RECORD_ALIGNMENT = 64;
+inline constexpr uint64_t RECORD_FLAG_PADDING = 1;
+
+struct CaptureFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numTensors;
+    uint64_t numRecords;
+    uint64_t recordBytes;
+    uint64_t dataOffset;
+};
+
+struct CaptureTensorEntry {
+    char name[MAX_TENSOR_NAME];
+    uint32_t dtype;
+    uint32_t rank;
+    uint64_t dims[MAX_TENSOR_RANK];     ///< Per-item shape, leading dimension 1.
+    uint64_t itemBytes;
+    uint64_t recordOffset;
+};
+
+struct CaptureRecordHeader {
+    uint64_t frameId;
+    uint64_t flags;
+};
+
+} // namespace capture
+
+
+/**
+ * @brief Appends host output tensors of each inference batch to a capture file.
+ *
+ * Used from a single thread after device-to-host transfers have completed.
+ */
+class InferenceCaptureWriter {
+
+    public:
+        /**
+         * @brief Create the capture file and write its tensor table.
+         * @param path Capture file path; parent directories are created.
+         * @param outputViews Host output views whose names, dtypes and shapes define the layout.
+         * @throws std::runtime_error if the file cannot be created or a view is not on the host.
+         */
+        InferenceCaptureWriter(const fs::path& path, const TensorViewMap& outputViews);
+
+        InferenceCaptureWriter(const InferenceCaptureWriter&) = delete;
+        InferenceCaptureWriter& operator=(const InferenceCaptureWriter&) = delete;
+
+        /**
+         * @brief Finalize the record count on destruction.
+         */
+        ~InferenceCaptureWriter();
+
+        /**
+         * @brief Append one record per batch item.
+         * @param outputViews Host output views holding the batch results.
+         * @param metas Batch metadata; frame ids and padding flags are stored with each record.
+         */
+        void append(const TensorViewMap& outputViews, const std::vector<FrameMetadata>& metas);
+
+        /**
+         * @brief Write the final record count and close the file.
+         */
+        void close();
+
+        /**
+         * @brief Number of records written so far.
+         */
+        uint64_t numRecords() const {
+            return m_header.numRecords;
+        }
+
+    private:
+        std::ofstream m_file;
+        fs::path m_path;
+        capture::CaptureFileHeader m_header{};
+        std::vector<capture::CaptureTensorEntry> m_entries;
+        std::vector<std::byte> m_record;
+};
+
+
+/**
+ * @brief Read-only memory mapping of a capture file.
+ */
+class InferenceCaptureReader {
+
+    public:
+        /**
+         * @brief Map a capture file and index its records by frame id.
+         * @throws std::runtime_error for missing, truncated or incompatible files.
+         */
+        explicit InferenceCaptureReader(const fs::path& path);
+
+        InferenceCaptureReader(const InferenceCaptureReader&) = delete;
+        InferenceCaptureReader& operator=(const InferenceCaptureReader&) = delete;
+
+        ~InferenceCaptureReader();
+
+        uint64_t numRecords() const {
+            return m_header.numRecords;
+        }
+
+        const std::vector<capture::CaptureTensorEntry>& tensors() const {
+            return m_entries;
+        }
+
+        /**
+         * @brief Tensor table entry by name, or nullptr when absent.
+         */
+        const capture::CaptureTensorEntry* findTensor(const std::string& name) const;
+
+        /**
+         * @brief Record index of a frame id.
+         * @throws std::runtime_error when the frame id was not captured.
+         */
+        uint64_t findRecord(uint64_t frameId) const;
+
+        /**
+         * @brief Header of a record.
+         */
+        const capture::CaptureRecordHeader& recordHeader(uint64_t record) const;
+
+        /**
+         * @brief Pointer into the mapping for one tensor of one record.
+         */
+        const std::byte* tensorData(uint64_t record, const capture::CaptureTensorEntry& tensor) const;
+
+    private:
+        void indexRecords();
+        const std::byte* recordBase(uint64_t record) const;
+
+        fs::path m_path;
+        int m_fd = -1;
+        const std::byte* m_mapping = nullptr;
+        size_t m_mappingBytes = 0;
+        capture::CaptureFileHeader m_header{};
+        std::vector<capture::CaptureTensorEntry> m_entries;
+        std::unordered_map<uint64_t, uint64_t> m_recordByFrameId;
+};
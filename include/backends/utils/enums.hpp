@@ -5,5 +5,8 @@
  */
 enum class BackendType {
     UNSET,
-    YoloSegTRT
+    YoloSegTRT,
+    YoloSegOcvCpu,
+    Replay,
+    Mock
 };
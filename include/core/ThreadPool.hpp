@@ -0,0 +1,71 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed-size pool of worker threads executing submitted tasks in FIFO order.
+ *
+ * Tasks are coarse (decoding a file, preprocessing an image), so a single
+ * mutex-protected queue is sufficient. The destructor finishes every queued
+ * task before joining the workers.
+ */
+class ThreadPool {
+
+    public:
+        /**
+         * @brief Start the workers.
+         * @param numThreads Number of worker threads, at least 1.
+         * @throws std::runtime_error if numThreads is zero.
+         */
+        explicit ThreadPool(size_t numThreads);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool();
+
+        /**
+         * @brief Queue a callable and return a future for its result.
+         *
+         * Exceptions thrown by the callable are rethrown from future::get().
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& task) {
+
+            using Result = std::invoke_result_t<std::decay_t<F>>;
+
+            auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+            std::future<Result> result = packaged->get_future();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_tasks.emplace_back([packaged]() { (*packaged)(); });
+            }
+            m_wakeup.notify_one();
+
+            return result;
+        }
+
+        size_t size() const {
+            return m_workers.size();
+        }
+
+    private:
+        void workerLoop();
+
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+        std::deque<std::function<void()>> m_tasks;
+        bool m_stopping = false;
+        std::vector<std::thread> m_workers;
+};
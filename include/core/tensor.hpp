@@ -328,6 +328,18 @@ TensorViewMap getTensorViews(const TensorMapType& tensorMap) {
     return views;
 }
 
+/**
+ * @brief Collect tensor names from a TensorViewMap.
+ */
+inline std::vector<std::string> TensorKeys(const TensorViewMap& bufferViews) {
+    std::vector<std::string> keys;
+    keys.reserve(bufferViews.size());
+    for (const auto& [name, tensor] : bufferViews) {
+        keys.push_back(name);
+    }
+    return keys;
+}
+
 /**
  * @brief Check if every tensor view is on a given device.
  */
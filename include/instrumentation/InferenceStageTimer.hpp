@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "core/cuda.hpp"
+#include "instrumentation/StageStatistics.hpp"
+
+/**
+ * @brief Splits one inference step into H2D, inference and D2H latencies.
+ *
+ * With a CUDA stream the boundaries are CUDA events recorded on that stream,
+ * so the durations reflect device execution rather than enqueue time; they are
+ * read in record() after the caller has synchronized the stream. Without a
+ * stream the transfers run synchronously and host timestamps are used. A null
+ * StageStatistics pointer disables all work.
+ */
+class InferenceStageTimer {
+
+    public:
+        explicit InferenceStageTimer(StageStatistics* stats):
+            m_stats(stats) {}
+
+        InferenceStageTimer(const InferenceStageTimer&) = delete;
+        InferenceStageTimer& operator=(const InferenceStageTimer&) = delete;
+
+        ~InferenceStageTimer() {
+            for (cudaEvent_t event : m_events) {
+                if (event) {
+                    cudaEventDestroy(event);
+                }
+            }
+        }
+
+        /**
+         * @brief Mark boundary 0 (start of H2D) through 3 (end of D2H).
+         */
+        void mark(size_t boundary, cudaStream_t stream) {
+            if (!m_stats) {
+                return;
+            }
+
+            if (stream) {
+                if (!m_events[boundary]) {
+                    CUDA_THROW(cudaEventCreate(&m_events[boundary]));
+                }
+                CUDA_THROW(cudaEventRecord(m_events[boundary], stream));
+            } else {
+                m_hostMarks[boundary] = std::chrono::steady_clock::now();
+            }
+            m_usedStream = stream != nullptr;
+        }
+
+        /**
+         * @brief Record the three stage latencies; the stream must already be synchronized.
+         */
+        void record(size_t frames) {
+            if (!m_stats) {
+                return;
+            }
+
+            constexpr PipelineStage stages[] = {PipelineStage::H2D, PipelineStage::INFERENCE, PipelineStage::D2H};
+
+            for (size_t i = 0; i < 3; ++i) {
+                uint64_t durationNs = 0;
+
+                if (m_usedStream) {
+                    float elapsedMs = 0.f;
+                    CUDA_THROW(cudaEventElapsedTime(&elapsedMs, m_events[i], m_events[i + 1]));
+                    durationNs = static_cast<uint64_t>(static_cast<double>(elapsedMs) * 1e6);
+                } else {
+                    durationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        m_hostMarks[i + 1] - m_hostMarks[i]
+                    ).count());
+                }
+
+                m_stats->record(stages[i], durationNs, frames);
+            }
+        }
+
+    private:
+        StageStatistics* m_stats;
+        bool m_usedStream = false;
+        std::array<cudaEvent_t, 4> m_events{};
+        std::array<std::chrono::steady_clock::time_point, 4> m_hostMarks{};
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Point-in-time copy of a LatencyHistogram, or the difference of two copies.
+ */
+struct HistogramSnapshot {
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    /**
+     * @brief Value at quantile q in [0, 1], reported as the bucket's upper bound.
+     */
+    uint64_t percentile(double q) const;
+
+    /**
+     * @brief Arithmetic mean of recorded values, 0 when empty.
+     */
+    double mean() const {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Values recorded between `earlier` and this snapshot.
+     *
+     * The interval maximum is the upper bound of the highest populated bucket,
+     * clamped to the overall maximum.
+     */
+    HistogramSnapshot since(const HistogramSnapshot& earlier) const;
+};
+
+/**
+ * @brief Lock-free log-linear latency histogram in the style of HdrHistogram.
+ *
+ * Values below 32 get exact buckets. Every power of two above that is split
+ * into 32 linear sub-buckets, so reported percentiles are within about 3% of
+ * the true value. Values are nanoseconds and saturate at 2^45 ns (about
+ * 9.8 hours). record() is wait-free apart from the max update and only
+ * performs relaxed atomic increments, so it is cheap enough for every batch.
+ */
+class LatencyHistogram {
+
+    public:
+        static constexpr size_t SUB_BUCKET_BITS = 5;
+        static constexpr size_t SUB_BUCKETS = size_t{1} << SUB_BUCKET_BITS;
+        static constexpr size_t MAX_EXPONENT = 44;
+        static constexpr size_t NUM_BUCKETS = SUB_BUCKETS * (MAX_EXPONENT - SUB_BUCKET_BITS + 2);
+
+        /**
+         * @brief Record one value in nanoseconds.
+         */
+        void record(uint64_t valueNs) noexcept {
+            m_buckets[bucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(valueNs, std::memory_order_relaxed);
+
+            uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+            while (valueNs > currentMax &&
+                   !m_max.compare_exchange_weak(currentMax, valueNs, std::memory_order_relaxed)) {
+            }
+        }
+
+        /**
+         * @brief Copy the current counters; concurrent record() calls may be partially visible.
+         */
+        HistogramSnapshot snapshot() const;
+
+        /**
+         * @brief Bucket index for a value.
+         */
+        static size_t bucketIndex(uint64_t value) noexcept {
+            if (value < SUB_BUCKETS) {
+                return static_cast<size_t>(value);
+            }
+
+            const size_t exponent = 63 - static_cast<size_t>(__builtin_clzll(value));
+            if (exponent > MAX_EXPONENT) {
+                return NUM_BUCKETS - 1;
+            }
+
+            const size_t shift = exponent - SUB_BUCKET_BITS;
+            const size_t subBucket = static_cast<size_t>(value >> shift) - SUB_BUCKETS;
+            return SUB_BUCKETS + shift * SUB_BUCKETS + subBucket;
+        }
+
+        /**
+         * @brief Largest value that maps to a bucket.
+         */
+        static uint64_t bucketUpperBound(size_t index) noexcept {
+            if (index < SUB_BUCKETS) {
+                return index;
+            }
+
+            const size_t shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+            const uint64_t subBucket = (index - SUB_BUCKETS) % SUB_BUCKETS;
+            return ((SUB_BUCKETS + subBucket + 1) << shift) - 1;
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, NUM_BUCKETS> m_buckets{};
+        std::atomic<uint64_t> m_count{0};
+        std::atomic<uint64_t> m_sum{0};
+        std::atomic<uint64_t> m_max{0};
+};
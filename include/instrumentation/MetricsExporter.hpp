@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include "instrumentation/MetricsRegistry.hpp"
+#include "instrumentation/StageStatistics.hpp"
+#include "logging/BaseLogger.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Periodically rewrites a Prometheus textfile with the current metrics.
+ *
+ * The file is written under a temporary name and renamed into place, so
+ * readers such as node_exporter's textfile collector never see a partial
+ * file. Exporting runs on its own thread and only reads atomics, so it does
+ * not slow the pipeline down. Stage latency summaries are appended when
+ * StageStatistics are given.
+ */
+class MetricsTextfileExporter {
+
+    public:
+        /**
+         * @brief Start exporting.
+         * @param registry Metrics to export.
+         * @param stageStats Optional stage latency statistics to export alongside.
+         * @param path Textfile path, conventionally ending in `.prom`.
+         * @param interval Time between rewrites.
+         * @param logger Destination for export errors.
+         * @throws std::runtime_error if the interval is zero.
+         */
+        MetricsTextfileExporter(
+            const MetricsRegistry& registry,
+            const StageStatistics* stageStats,
+            fs::path path,
+            std::chrono::milliseconds interval,
+            BaseLogger& logger
+        );
+
+        MetricsTextfileExporter(const MetricsTextfileExporter&) = delete;
+        MetricsTextfileExporter& operator=(const MetricsTextfileExporter&) = delete;
+
+        ~MetricsTextfileExporter();
+
+        /**
+         * @brief Stop the export thread and write the final values.
+         */
+        void stop();
+
+        /**
+         * @brief Write the current values once.
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void writeNow() const;
+
+    private:
+        void exportLoop();
+
+        const MetricsRegistry& m_registry;
+        const StageStatistics* m_stageStats;
+        fs::path m_path;
+        std::chrono::milliseconds m_interval;
+        BaseLogger& m_logger;
+
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+        bool m_stopping = false;
+        std::thread m_thread;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Monotonically increasing metric.
+ */
+class Counter {
+
+    public:
+        void increment(uint64_t amount = 1) noexcept {
+            m_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        uint64_t value() const noexcept {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> m_value{0};
+};
+
+/**
+ * @brief Metric that can go up and down, e.g. a queue depth.
+ */
+class Gauge {
+
+    public:
+        void set(int64_t value) noexcept {
+            m_value.store(value, std::memory_order_relaxed);
+        }
+
+        void add(int64_t amount) noexcept {
+            m_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        int64_t value() const noexcept {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<int64_t> m_value{0};
+};
+
+/**
+ * @brief Fixed-bucket distribution exported as a Prometheus histogram.
+ *
+ * Bucket bounds are inclusive upper bounds in increasing order; an implicit
+ * +Inf bucket catches everything above the last bound. observe() scans the
+ * bounds linearly, so keep the bucket count small.
+ */
+class Histogram {
+
+    public:
+        explicit Histogram(std::vector<double> upperBounds);
+
+        void observe(double value) noexcept {
+            size_t bucket = 0;
+            while (bucket < m_upperBounds.size() && value > m_upperBounds[bucket]) {
+                ++bucket;
+            }
+            m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+
+            double sum = m_sum.load(std::memory_order_relaxed);
+            while (!m_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+            }
+        }
+
+        const std::vector<double>& upperBounds() const {
+            return m_upperBounds;
+        }
+
+        /**
+         * @brief Count of values per bucket, not cumulative; the last entry is +Inf.
+         */
+        std::vector<uint64_t> bucketCounts() const;
+
+        double sum() const noexcept {
+            return m_sum.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::vector<double> m_upperBounds;
+        std::unique_ptr<std::atomic<uint64_t>[]> m_counts;
+        std::atomic<double> m_sum{0.0};
+};
+
+/**
+ * @brief Named counters, gauges, and histograms rendered in the Prometheus text format.
+ *
+ * Registration takes a mutex and returns a reference that stays valid for
+ * the registry's lifetime; components register in their constructors and
+ * update through the reference, which only touches relaxed atomics.
+ * Registering the same name and labels again returns the existing metric.
+ * Labels are given preformatted, e.g. `queue="inference"`.
+ */
+class MetricsRegistry {
+
+    public:
+        MetricsRegistry() = default;
+
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        /**
+         * @brief Process-wide registry used by pipeline components.
+         */
+        static MetricsRegistry& global();
+
+        /**
+         * @throws std::runtime_error if the name is already registered with another type.
+         */
+        Counter& counter(const std::string& name, const std::string& help, const std::string& labels = "");
+
+        /**
+         * @throws std::runtime_error if the name is already registered with another type.
+         */
+        Gauge& gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+
+        /**
+         * @throws std::runtime_error if the name is already registered with another type
+         *         or the bounds are not strictly increasing.
+         */
+        Histogram& histogram(
+            const std::string& name,
+            const std::string& help,
+            const std::vector<double>& upperBounds,
+            const std::string& labels = ""
+        );
+
+        /**
+         * @brief Render every metric in the Prometheus text exposition format.
+         */
+        std::string render() const;
+
+    private:
+        enum class MetricType {
+            COUNTER,
+            GAUGE,
+            HISTOGRAM
+        };
+
+        struct Family {
+            MetricType type;
+            std::string help;
+            std::map<std::string, std::unique_ptr<Counter>> counters;
+            std::map<std::string, std::unique_ptr<Gauge>> gauges;
+            std::map<std::string, std::unique_ptr<Histogram>> histograms;
+        };
+
+        Family& family(const std::string& name, const std::string& help, MetricType type);
+
+        mutable std::mutex m_mutex;
+        std::map<std::string, Family> m_families;
+};
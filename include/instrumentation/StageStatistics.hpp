@@ -0,0 +1,153 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "instrumentation/LatencyHistogram.hpp"
+#include "instrumentation/utils/enums.hpp"
+#include "logging/BaseLogger.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Latency and frame counters of every stage at one point in time.
+ */
+struct StageStatisticsSnapshot {
+    std::array<HistogramSnapshot, NUM_PIPELINE_STAGES> latency;
+    std::array<uint64_t, NUM_PIPELINE_STAGES> frames{};
+    double elapsedSeconds = 0.0;
+
+    /**
+     * @brief Counters accumulated between `earlier` and this snapshot.
+     */
+    StageStatisticsSnapshot since(const StageStatisticsSnapshot& earlier) const;
+};
+
+/**
+ * @brief Per-stage batch latency histograms and frame counters for one run.
+ *
+ * Any worker thread may call record(). Periodic and final reports are meant
+ * to be produced from a single thread, normally the one that completes
+ * batches at the sink.
+ */
+class StageStatistics {
+
+    public:
+        StageStatistics();
+
+        StageStatistics(const StageStatistics&) = delete;
+        StageStatistics& operator=(const StageStatistics&) = delete;
+
+        /**
+         * @brief Record one batch processed by a stage.
+         * @param stage Timed stage.
+         * @param durationNs Batch latency in nanoseconds.
+         * @param frames Source frames in the batch, excluding padding.
+         */
+        void record(PipelineStage stage, uint64_t durationNs, size_t frames) noexcept {
+            StageCounters& counters = m_stages[static_cast<size_t>(stage)];
+            counters.latency.record(durationNs);
+            counters.frames.fetch_add(frames, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Copy all stage counters and the elapsed time since construction.
+         */
+        StageStatisticsSnapshot snapshot() const;
+
+        /**
+         * @brief Log statistics accumulated since the previous interval report.
+         */
+        void logIntervalReport(BaseLogger& logger);
+
+        /**
+         * @brief Log whole-run statistics and write them as JSON.
+         * @param logger Destination for the text report.
+         * @param jsonPath JSON report path; skipped when empty.
+         * @throws std::runtime_error if the JSON file cannot be written.
+         */
+        void logFinalReport(BaseLogger& logger, const fs::path& jsonPath);
+
+        /**
+         * @brief Render a snapshot as an aligned text table.
+         */
+        static std::string formatText(const StageStatisticsSnapshot& snapshot, const std::string& label);
+
+        /**
+         * @brief Render a snapshot as a JSON object.
+         */
+        static std::string formatJson(const StageStatisticsSnapshot& snapshot);
+
+        /**
+         * @brief Render a snapshot as Prometheus summaries of stage latency and frame counters.
+         */
+        static std::string formatPrometheus(const StageStatisticsSnapshot& snapshot);
+
+    private:
+        struct StageCounters {
+            LatencyHistogram latency;
+            std::atomic<uint64_t> frames{0};
+        };
+
+        std::array<StageCounters, NUM_PIPELINE_STAGES> m_stages;
+        std::chrono::steady_clock::time_point m_startTime;
+        StageStatisticsSnapshot m_lastReport;
+};
+
+/**
+ * @brief Times a scope and records it as one batch of a stage.
+ *
+ * A null StageStatistics pointer disables timing entirely.
+ */
+class ScopedStageTimer {
+
+    public:
+        ScopedStageTimer(StageStatistics* stats, PipelineStage stage, size_t frames = 0):
+            m_stats(stats),
+            m_stage(stage),
+            m_frames(frames) {
+
+            if (m_stats) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ScopedStageTimer(const ScopedStageTimer&) = delete;
+        ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+        ~ScopedStageTimer() {
+            if (m_stats) {
+                const auto elapsed = std::chrono::steady_clock::now() - m_start;
+                m_stats->record(
+                    m_stage,
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                    m_frames
+                );
+            }
+        }
+
+        /**
+         * @brief Set the frame count once it is known, e.g. after reading a batch.
+         */
+        void setFrames(size_t frames) {
+            m_frames = frames;
+        }
+
+        /**
+         * @brief Drop the measurement, e.g. when the source is exhausted.
+         */
+        void cancel() {
+            m_stats = nullptr;
+        }
+
+    private:
+        StageStatistics* m_stats;
+        PipelineStage m_stage;
+        size_t m_frames;
+        std::chrono::steady_clock::time_point m_start;
+};
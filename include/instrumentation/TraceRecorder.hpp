@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/** @brief Frame id recorded when a span is not tied to a frame. */
+inline constexpr uint64_t TRACE_NO_FRAME = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief One completed span.
+ */
+struct TraceEvent {
+    const char* name = nullptr;     ///< Span name; must have static storage duration.
+    uint64_t startNs = 0;           ///< Start time relative to recorder creation.
+    uint64_t durationNs = 0;        ///< Span duration.
+    uint64_t batchId = 0;           ///< Batch sequence number.
+    uint64_t frameId = TRACE_NO_FRAME; ///< First source frame id in the batch.
+    uint32_t frames = 0;            ///< Source frames covered by the span.
+};
+
+/**
+ * @brief Records CPU-side pipeline spans and writes them as Chrome Trace Event JSON.
+ *
+ * Each thread appends to its own fixed-capacity buffer. The buffer is
+ * registered under a mutex on the thread's first span; after that a span
+ * costs two clock reads and a store, with no locks or shared cache lines.
+ * Spans beyond a thread's capacity are dropped and counted. The output loads
+ * in chrome://tracing and https://ui.perfetto.dev. Spans of the same batch are
+ * linked with flow arrows, so they can be followed across stage threads.
+ */
+class TraceRecorder {
+
+    public:
+        /**
+         * @brief Create a recorder.
+         * @param eventsPerThread Span capacity of each thread's buffer.
+         */
+        explicit TraceRecorder(size_t eventsPerThread);
+
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        /**
+         * @brief Nanoseconds since the recorder was created.
+         */
+        uint64_t nowNs() const noexcept {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_startTime
+            ).count());
+        }
+
+        /**
+         * @brief Append a completed span to the calling thread's buffer.
+         */
+        void record(const TraceEvent& event);
+
+        /**
+         * @brief Name the calling thread in the trace, e.g. "preprocess-1".
+         */
+        void setThreadName(const std::string& name);
+
+        /**
+         * @brief Spans dropped because a thread buffer was full.
+         */
+        uint64_t droppedEvents() const;
+
+        /**
+         * @brief Spans currently held across all thread buffers.
+         */
+        size_t recordedEvents() const;
+
+        /**
+         * @brief Write all spans as Chrome Trace Event JSON.
+         *
+         * Meant to be called once the recording threads have stopped; spans
+         * recorded concurrently may or may not be included.
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void write(const fs::path& path) const;
+
+    private:
+        struct ThreadBuffer {
+            uint64_t threadId = 0;
+            std::string threadName;
+            std::vector<TraceEvent> events;
+            std::atomic<size_t> size{0};
+            std::atomic<uint64_t> dropped{0};
+        };
+
+        ThreadBuffer& localBuffer();
+
+        const uint64_t m_recorderId;
+        const size_t m_eventsPerThread;
+        const std::chrono::steady_clock::time_point m_startTime;
+
+        mutable std::mutex m_buffersMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+/**
+ * @brief Records the enclosing scope as one span.
+ *
+ * A null TraceRecorder pointer disables the span entirely.
+ */
+class ScopedTraceSpan {
+
+    public:
+        ScopedTraceSpan(
+            TraceRecorder* recorder,
+            const char* name,
+            uint64_t batchId,
+            uint64_t frameId = TRACE_NO_FRAME,
+            size_t frames = 0
+        ):
+            m_recorder(recorder) {
+
+            if (m_recorder) {
+                m_event.name = name;
+                m_event.batchId = batchId;
+                m_event.frameId = frameId;
+                m_event.frames = static_cast<uint32_t>(frames);
+                m_event.startNs = m_recorder->nowNs();
+            }
+        }
+
+        ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+        ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+
+        ~ScopedTraceSpan() {
+            if (m_recorder) {
+                m_event.durationNs = m_recorder->nowNs() - m_event.startNs;
+                m_recorder->record(m_event);
+            }
+        }
+
+        /**
+         * @brief Set the frame range once it is known, e.g. after reading a batch.
+         */
+        void setFrames(uint64_t frameId, size_t frames) {
+            m_event.frameId = frameId;
+            m_event.frames = static_cast<uint32_t>(frames);
+        }
+
+        /**
+         * @brief Drop the span, e.g. when the source is exhausted.
+         */
+        void cancel() {
+            m_recorder = nullptr;
+        }
+
+    private:
+        TraceRecorder* m_recorder;
+        TraceEvent m_event;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Timed pipeline stages, in execution order.
+ */
+enum class PipelineStage {
+    READ,
+    PREPROCESS,
+    H2D,
+    INFERENCE,
+    D2H,
+    POSTPROCESS,
+    SINK
+};
+
+inline constexpr size_t NUM_PIPELINE_STAGES = 7;
+
+/**
+ * @brief Lowercase stage name used in reports.
+ */
+inline const char* pipelineStageName(PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::READ: return "read";
+        case PipelineStage::PREPROCESS: return "preprocess";
+        case PipelineStage::H2D: return "h2d";
+        case PipelineStage::INFERENCE: return "inference";
+        case PipelineStage::D2H: return "d2h";
+        case PipelineStage::POSTPROCESS: return "postprocess";
+        case PipelineStage::SINK: return "sink";
+    }
+    return "unknown";
+}
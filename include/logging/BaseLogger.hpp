@@ -6,14 +6,26 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 
+#include "logging/LogRecordQueue.hpp"
 #include "logging/enums.hpp"
 
 namespace fs = std::filesystem;
 
 /**
  * @brief Thread-safe file logger used by application, backend, and pipeline code.
+ *
+ * In SYNC mode every message is formatted and written under a mutex. In ASYNC
+ * mode the calling thread formats into a thread-local buffer and pushes the
+ * line into a lock-free queue; a background thread drains the queue into the
+ * file. When the queue is full, VERBOSE and INFO lines are dropped and counted,
+ * while WARNING and above wait for space. ERROR and above also wait until the
+ * line is written, so errors are on disk before an exception unwinds.
  */
 class BaseLogger {
 
@@ -30,6 +42,25 @@ class BaseLogger {
          * @brief Creates a logger with an explicit output path and severity threshold.
          */
         explicit BaseLogger(const fs::path& fileName, LoggingSeverityType severity);
+        /**
+         * @brief Creates a logger with an explicit output path, severity threshold, and write mode.
+         * @param asyncQueueCapacity Queued lines in ASYNC mode, rounded up to a power of two.
+         */
+        explicit BaseLogger(
+            const fs::path& fileName,
+            LoggingSeverityType severity,
+            LoggingMode mode,
+            size_t asyncQueueCapacity = DEFAULT_ASYNC_QUEUE_CAPACITY
+        );
+
+        BaseLogger(const BaseLogger&) = delete;
+        BaseLogger& operator=(const BaseLogger&) = delete;
+
+        /**
+         * @brief Drains pending asynchronous lines and stops the writer thread.
+         */
+        ~BaseLogger();
+
         /**
          * @brief Writes one log message when the severity passes the configured threshold.
          */
@@ -44,40 +75,81 @@ class BaseLogger {
          */
         template <class ...Ts>
         void logConcatMessage(LoggingSeverityType severity, Ts&&... xs) {
-            
-            try {
-                std::lock_guard<std::mutex> lock(m_loggerMutex);
-                if(severity >= m_severity){
 
-                    if(severity == LoggingSeverityType::INTERNAL_ERROR)
-                        m_logStream << "[INTERNAL ERROR] ";
-
-                    else if(severity == LoggingSeverityType::ERROR)
-                        m_logStream << "[ERROR] ";
-
-                    else if(severity == LoggingSeverityType::WARNING)
-                        m_logStream << "[WARNING] ";
-                    
-                    else
-                        m_logStream << "[INFO] ";
+            if (!isEnabled(severity)) {
+                return;
+            }
 
-                    (m_logStream << ... << std::forward<Ts>(xs));
+            try {
+                if (m_mode == LoggingMode::ASYNC) {
+                    std::ostringstream& stream = threadFormatStream();
+                    stream << severityPrefix(severity);
+                    (stream << ... << std::forward<Ts>(xs));
+                    enqueue(severity, stream.str());
+                    return;
                 }
 
+                std::lock_guard<std::mutex> lock(m_loggerMutex);
+                m_logStream << severityPrefix(severity);
+                (m_logStream << ... << std::forward<Ts>(xs));
+
             } catch (const std::exception& e) {
                 std::cerr << "Unknown logger failure \n" << e.what();
             }
         }
 
+        /**
+         * @brief True when messages of this severity pass the runtime threshold.
+         */
+        bool isEnabled(LoggingSeverityType severity) const noexcept {
+            return severity >= m_severity;
+        }
+
+        /**
+         * @brief Block until every queued line has been written and flushed.
+         */
+        void flush();
+
+        /**
+         * @brief Lines dropped because the asynchronous queue was full.
+         */
+        uint64_t droppedMessages() const noexcept {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+        static constexpr size_t DEFAULT_ASYNC_QUEUE_CAPACITY = 8192;
+
     private:
         /**
          * @brief Opens the configured log stream.
          */
         bool assignStream();
 
+        static const char* severityPrefix(LoggingSeverityType severity) noexcept;
+
+        /**
+         * @brief Cleared per-thread stream reused to format asynchronous lines.
+         */
+        static std::ostringstream& threadFormatStream();
+
+        /**
+         * @brief Hand a formatted line to the writer thread.
+         */
+        void enqueue(LoggingSeverityType severity, std::string text);
+
+        void writerLoop();
+
     private:
         LoggingSeverityType m_severity;
+        LoggingMode m_mode = LoggingMode::SYNC;
         std::filesystem::path m_logFilePath;
         std::ofstream m_logStream;
         std::mutex m_loggerMutex;
+
+        std::unique_ptr<LogRecordQueue> m_queue;
+        std::thread m_writer;
+        std::atomic<bool> m_stopWriter{false};
+        std::atomic<uint64_t> m_enqueued{0};
+        std::atomic<uint64_t> m_written{0};
+        std::atomic<uint64_t> m_dropped{0};
 };
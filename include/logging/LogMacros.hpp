@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "logging/BaseLogger.hpp"
+
+/**
+ * @brief Lowest severity compiled into YOLO_LOG call sites, as an integer LoggingSeverityType.
+ *
+ * Set through the YOLO_LOG_MIN_SEVERITY CMake cache variable. Call sites
+ * below it compile to nothing, so their arguments are neither evaluated nor
+ * formatted. Direct BaseLogger calls are unaffected.
+ */
+#ifndef YOLO_LOG_MIN_SEVERITY
+    #define YOLO_LOG_MIN_SEVERITY 0
+#endif
+
+/**
+ * @brief Time-based limiter for a single log call site.
+ */
+class LogRateLimiter {
+
+    public:
+        explicit LogRateLimiter(std::chrono::milliseconds interval):
+            m_intervalNs(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count()) {}
+
+        /**
+         * @brief True for at most one caller per interval.
+         */
+        bool allow() noexcept {
+            const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count();
+
+            int64_t next = m_nextAllowedNs.load(std::memory_order_relaxed);
+            return now >= next &&
+                m_nextAllowedNs.compare_exchange_strong(next, now + m_intervalNs, std::memory_order_relaxed);
+        }
+
+    private:
+        const int64_t m_intervalNs;
+        std::atomic<int64_t> m_nextAllowedNs{0};
+};
+
+/**
+ * @brief Log through BaseLogger::logConcatMessage unless compiled out or below the runtime threshold.
+ */
+#define YOLO_LOG(logger, severity, ...)                                                         \
+    do {                                                                                        \
+        if (static_cast<int>(severity) >= YOLO_LOG_MIN_SEVERITY && (logger).isEnabled(severity)) { \
+            (logger).logConcatMessage((severity), __VA_ARGS__);                                 \
+        }                                                                                       \
+    } while (0)
+
+/**
+ * @brief Log the 1st, (n+1)th, (2n+1)th, ... occurrence of this call site.
+ */
+#define YOLO_LOG_EVERY_N(logger, severity, n, ...)                                              \
+    do {                                                                                        \
+        if (static_cast<int>(severity) >= YOLO_LOG_MIN_SEVERITY && (logger).isEnabled(severity)) { \
+            static std::atomic<uint64_t> yoloLogOccurrences{0};                                 \
+            if (yoloLogOccurrences.fetch_add(1, std::memory_order_relaxed) % (n) == 0) {        \
+                (logger).logConcatMessage((severity), __VA_ARGS__);                             \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
+
+/**
+ * @brief Log this call site at most once per `intervalMs` milliseconds across all threads.
+ */
+#define YOLO_LOG_EVERY_MS(logger, severity, intervalMs, ...)                                    \
+    do {                                                                                        \
+        if (static_cast<int>(severity) >= YOLO_LOG_MIN_SEVERITY && (logger).isEnabled(severity)) { \
+            static LogRateLimiter yoloLogLimiter{std::chrono::milliseconds(intervalMs)};        \
+            if (yoloLogLimiter.allow()) {                                                       \
+                (logger).logConcatMessage((severity), __VA_ARGS__);                             \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
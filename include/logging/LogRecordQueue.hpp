@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "logging/enums.hpp"
+
+/**
+ * @brief One formatted log line waiting to be written.
+ */
+struct LogRecord {
+    LoggingSeverityType severity = LoggingSeverityType::INFO;
+    std::string text;
+};
+
+/**
+ * @brief Bounded lock-free multi-producer/single-consumer queue of log records.
+ *
+ * Every slot carries a sequence number that tells producers and the consumer
+ * whose turn it is (Vyukov's bounded queue). Producers claim a slot with one
+ * compare-and-swap and never wait on each other or on the consumer; a full
+ * queue is reported to the caller instead of blocking.
+ */
+class LogRecordQueue {
+
+    public:
+        /**
+         * @brief Construct a queue; the capacity is rounded up to a power of two.
+         * @param capacity Minimum number of records the queue can hold.
+         */
+        explicit LogRecordQueue(size_t capacity):
+            m_capacity(roundUpPowerOfTwo(capacity)),
+            m_mask(m_capacity - 1),
+            m_slots(new Slot[m_capacity]) {
+
+            for (size_t i = 0; i < m_capacity; ++i) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        LogRecordQueue(const LogRecordQueue&) = delete;
+        LogRecordQueue& operator=(const LogRecordQueue&) = delete;
+
+        /**
+         * @brief Move a record into the queue if there is space; callable from any thread.
+         * @return false when the queue is full.
+         */
+        bool tryPush(LogRecord& record) {
+
+            size_t position = m_enqueuePos.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot = m_slots[position & m_mask];
+                const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                if (difference == 0) {
+                    if (m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        slot.record = std::move(record);
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Move the oldest record out; only the consumer thread may call this.
+         * @return false when the queue is empty.
+         */
+        bool tryPop(LogRecord& record) {
+
+            Slot& slot = m_slots[m_dequeuePos & m_mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+            if (sequence != m_dequeuePos + 1) {
+                return false;
+            }
+
+            record = std::move(slot.record);
+            slot.sequence.store(m_dequeuePos + m_capacity, std::memory_order_release);
+            ++m_dequeuePos;
+            return true;
+        }
+
+        size_t capacity() const {
+            return m_capacity;
+        }
+
+    private:
+        static size_t roundUpPowerOfTwo(size_t value) {
+            size_t capacity = 2;
+            while (capacity < value) {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+        struct Slot {
+            std::atomic<size_t> sequence{0};
+            LogRecord record;
+        };
+
+        const size_t m_capacity;
+        const size_t m_mask;
+        std::unique_ptr<Slot[]> m_slots;
+
+        alignas(64) std::atomic<size_t> m_enqueuePos{0};
+        alignas(64) size_t m_dequeuePos = 0;
+};
@@ -21,3 +21,11 @@ enum class LoggingSeverityType {
  * @brief Short alias for logger severity.
  */
 using Severity = LoggingSeverityType;
+
+/**
+ * @brief How BaseLogger writes messages.
+ */
+enum class LoggingMode {
+    SYNC,   ///< Format and write under a mutex on the calling thread.
+    ASYNC   ///< Format on the calling thread, write on a background thread.
+};
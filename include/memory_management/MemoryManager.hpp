@@ -1,19 +1,24 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "logging/BaseLogger.hpp"
 #include "memory_management/enums.hpp"
 #include "memory_management/utils.hpp"
+#include "memory_management/PipelineTensorContextRing.hpp"
 
 /**
  * @brief Owns tensor storage and exposes pipeline-stage tensor views.
  *
  * The memory manager allocates configured tensor groups, creates stage-specific
  * contexts, and performs copies or unified-memory prefetches between groups.
+ * Every configured group is allocated once per tensor slot, so overlapping
+ * executors can keep several batches in flight without sharing storage.
  */
 class MemoryManager {
     public:
@@ -21,11 +26,13 @@ class MemoryManager {
         /**
          * @brief Construct with pipeline tensor group configuration.
          * @param groupLists Preprocessing, inference, and postprocessing groups.
+         * @param numSlots Number of independent copies of every tensor group.
+         * @throws std::runtime_error if numSlots is zero.
          */
-        explicit MemoryManager(TensorGroupConfig groupLists);
+        explicit MemoryManager(TensorGroupConfig groupLists, size_t numSlots = 1);
 
         /**
-         * @brief Allocate one tensor group from tensor specifications.
+         * @brief Allocate one tensor group in every slot from tensor specifications.
          * @param tensorSpecs Tensor specifications keyed by model tensor name.
          * @param group Group to allocate.
          */
@@ -38,10 +45,17 @@ class MemoryManager {
         void allocateAllTensors(const TensorSpecMap& tensorSpecs);
 
         /**
-         * @brief Create the tensor contexts consumed by the pipeline.
+         * @brief Create the tensor contexts consumed by the pipeline for one slot.
+         * @param slot Tensor slot index in [0, numSlots()).
          * @return Context containing preprocessing, inference, postprocessing, and transfer views.
          */
-        PipelineTensorContext createPipelineTensorContext();
+        PipelineTensorContext createPipelineTensorContext(size_t slot = 0);
+
+        /**
+         * @brief Create one pipeline context per slot, wrapped in an acquire/release ring.
+         * @return Ring handing out slot `sequence % numSlots()` to batch `sequence`.
+         */
+        std::unique_ptr<PipelineTensorContextRing> createPipelineTensorContextRing();
 
         /**
          * @brief Execute tensor transfers or readiness operations.
@@ -58,14 +72,47 @@ class MemoryManager {
         /**
          * @brief Access mutable tensor views for an allocated group.
          */
-        TensorViewMap& getTensorViewsFromGroup(TensorGroup group);
+        TensorViewMap& getTensorViewsFromGroup(TensorGroup group, size_t slot = 0);
 
         /**
          * @brief Access const tensor views for an allocated group.
          */
-        const TensorViewMap& getTensorViewsFromGroup(TensorGroup group) const;
+        const TensorViewMap& getTensorViewsFromGroup(TensorGroup group, size_t slot = 0) const;
+
+        /**
+         * @brief Number of independent tensor slots.
+         */
+        size_t numSlots() const {
+            return m_slots.size();
+        }
+
+        /**
+         * @brief Log allocated bytes per tensor group and per slot.
+         * @param logger Destination logger.
+         */
+        void logMemoryUsage(BaseLogger& logger) const;
 
     private:
+        /**
+         * @brief Owning storage and views for one copy of every tensor group.
+         */
+        struct TensorSlot {
+            HostTensorMap hostInputs;
+            PinnedHostTensorMap pinnedInputs;
+            CudaTensorMap deviceInputs;
+            UnifiedTensorMap unifiedInputs;
+
+            HostTensorMap hostOutputs;
+            PinnedHostTensorMap pinnedOutputs;
+            CudaTensorMap deviceOutputs;
+            UnifiedTensorMap unifiedOutputs;
+
+            HostTensorMap hostPostProcessOutputs;
+            CudaTensorMap devicePostProcessOutputs;
+
+            std::unordered_map<TensorGroup, TensorViewMap> tensorViewsByGroup;
+        };
+
         template <typename TensorMapType>
         void allocateBuffers(TensorMapType& tensorMap, const TensorSpecMap& tensorSpecs) {
             using TensorType = typename TensorMapType::mapped_type;
@@ -84,13 +131,14 @@ class MemoryManager {
             }
         }
 
+        void allocateSlotGroup(TensorSlot& slot, const TensorSpecMap& tensorSpecs, TensorGroup group);
         bool supportsGroup(TensorGroup group) const;
         bool hasAllocatedGroup(TensorGroup group) const;
         TensorGroup selectFirstAllocatedGroup(const TensorGroupList& groups, const std::string& label) const;
         TensorGroup selectInferenceInputGroup() const;
         TensorGroup selectInferenceOutputGroup() const;
         std::vector<TensorGroup> allConfiguredGroups() const;
-        std::vector<TensorTransfer> makeTransfers(TensorGroup sourceGroup, TensorGroup targetGroup);
+        std::vector<TensorTransfer> makeTransfers(TensorGroup sourceGroup, TensorGroup targetGroup, size_t slot);
         DeviceType getTensorViewDevice(const TensorViewMap& tensorMap) const;
         void appendUnifiedReadiness(
             std::vector<TensorTransfer>& transfers,
@@ -99,19 +147,6 @@ class MemoryManager {
             DeviceType targetDevice
         );
 
-        HostTensorMap m_hostInputs;
-        PinnedHostTensorMap m_pinnedInputs;
-        CudaTensorMap m_deviceInputs;
-        UnifiedTensorMap m_unifiedInputs;
-
-        HostTensorMap m_hostOutputs;
-        PinnedHostTensorMap m_pinnedOutputs;
-        CudaTensorMap m_deviceOutputs;
-        UnifiedTensorMap m_unifiedOutputs;
-
-        HostTensorMap m_hostPostProcessOutputs;
-        CudaTensorMap m_devicePostProcessOutputs;
-
-        std::unordered_map<TensorGroup, TensorViewMap> m_TensorViewsByGroup;
+        std::vector<TensorSlot> m_slots;
         TensorGroupConfig m_groupLists;
 };
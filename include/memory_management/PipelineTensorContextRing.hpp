@@ -0,0 +1,105 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "memory_management/utils.hpp"
+
+/**
+ * @brief Ring of per-slot pipeline tensor contexts with acquire/release semantics.
+ *
+ * Batch `sequence` always uses slot `sequence % size()`. acquire() blocks until
+ * the previous user of that slot, batch `sequence - size()`, has called
+ * release(). Handing out slots strictly in sequence order means a batch can
+ * never wait on a slot held by a later batch, so overlapping stages cannot
+ * deadlock on tensor storage.
+ */
+class PipelineTensorContextRing {
+
+    public:
+        /**
+         * @brief Construct from one context per tensor slot.
+         * @param contexts Contexts created by MemoryManager, indexed by slot.
+         * @throws std::runtime_error when no contexts are given.
+         */
+        explicit PipelineTensorContextRing(std::vector<PipelineTensorContext> contexts):
+            m_contexts(std::move(contexts)) {
+
+            if (m_contexts.empty()) {
+                throw std::runtime_error("PipelineTensorContextRing requires at least one slot");
+            }
+
+            m_nextSequence.reserve(m_contexts.size());
+            for (size_t slot = 0; slot < m_contexts.size(); ++slot) {
+                m_nextSequence.push_back(slot);
+            }
+        }
+
+        PipelineTensorContextRing(const PipelineTensorContextRing&) = delete;
+        PipelineTensorContextRing& operator=(const PipelineTensorContextRing&) = delete;
+
+        /**
+         * @brief Number of slots in the ring.
+         */
+        size_t size() const {
+            return m_contexts.size();
+        }
+
+        /**
+         * @brief Context assigned to a batch sequence, without synchronization.
+         */
+        PipelineTensorContext& at(size_t sequence) {
+            return m_contexts[sequence % m_contexts.size()];
+        }
+
+        /**
+         * @brief Block until the slot for `sequence` is free and return its context.
+         * @param sequence Batch sequence number.
+         * @return Slot context, or nullptr when the ring was cancelled.
+         */
+        PipelineTensorContext* acquire(size_t sequence) {
+            const size_t slot = sequence % m_contexts.size();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_released.wait(lock, [&]() {
+                return m_cancelled || m_nextSequence[slot] == sequence;
+            });
+
+            return m_cancelled ? nullptr : &m_contexts[slot];
+        }
+
+        /**
+         * @brief Return the slot used by `sequence` to the ring.
+         * @param sequence Batch sequence number passed to acquire().
+         */
+        void release(size_t sequence) {
+            const size_t slot = sequence % m_contexts.size();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_nextSequence[slot] = sequence + m_contexts.size();
+            }
+            m_released.notify_all();
+        }
+
+        /**
+         * @brief Wake all waiters; subsequent acquire() calls return nullptr.
+         */
+        void cancel() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cancelled = true;
+            }
+            m_released.notify_all();
+        }
+
+    private:
+        std::vector<PipelineTensorContext> m_contexts;
+        std::vector<size_t> m_nextSequence;
+        std::mutex m_mutex;
+        std::condition_variable m_released;
+        bool m_cancelled = false;
+};
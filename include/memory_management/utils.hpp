@@ -16,6 +16,25 @@ struct TensorGroupConfig {
     TensorGroupList postProcessing;
 };
 
+/**
+ * @brief Return the YAML spelling of a tensor group for diagnostics.
+ */
+inline const char* tensorGroupName(TensorGroup group) {
+    switch (group) {
+        case TensorGroup::HostInput: return "HostInput";
+        case TensorGroup::PinnedInput: return "PinnedInput";
+        case TensorGroup::DeviceInput: return "DeviceInput";
+        case TensorGroup::UnifiedInput: return "UnifiedInput";
+        case TensorGroup::HostOutput: return "HostOutput";
+        case TensorGroup::PinnedOutput: return "PinnedOutput";
+        case TensorGroup::DeviceOutput: return "DeviceOutput";
+        case TensorGroup::UnifiedOutput: return "UnifiedOutput";
+        case TensorGroup::HostPostProcessOutput: return "HostPostProcessOutput";
+        case TensorGroup::DevicePostProcessOutput: return "DevicePostProcessOutput";
+    }
+    return "Unknown";
+}
+
 /**
  * @brief Transfer/readiness operation between tensor groups.
  */
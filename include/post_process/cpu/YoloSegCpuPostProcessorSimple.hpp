@@ -6,6 +6,7 @@
 
 #include "post_process/interface/PostProcessor.hpp"
 #include "post_process/config/PostProcessorConfig.hpp"
+#include "instrumentation/MetricsRegistry.hpp"
 
 namespace fs = std::filesystem;
 
@@ -27,6 +28,9 @@ struct YoloSegCpuPostProcessorSimpleSettings {
  * - decode boxes/scores/mask coefficients,
  * - run NMS,
  * - generate and save segmentation outputs.
+ *
+ * For letterboxed frames, boxes and masks are taken in network input pixels
+ * and the normalized detections are mapped back onto the frame.
  */
 class YoloSegCpuPostProcessorSimple : public PostProcessor {
 
@@ -51,4 +55,13 @@ class YoloSegCpuPostProcessorSimple : public PostProcessor {
         float m_confidenceThresh, m_iouThresh, m_maskThresh;
         size_t m_maxDetections;
 
+        Histogram& m_detectionsPerFrame = MetricsRegistry::global().histogram(
+            "yoloseg_postprocess_detections_per_frame",
+            "Detections kept per source frame after NMS.",
+            {0, 1, 2, 5, 10, 20, 50, 100, 200}
+        );
+        Counter& m_candidates = MetricsRegistry::global().counter(
+            "yoloseg_postprocess_candidates_total", "Boxes above the confidence threshold before NMS."
+        );
+
 };
@@ -210,6 +210,17 @@ bool normalizeDetectionInPlace(
 );
 
 
+/**
+ * @brief Maps a detection normalized to the network input onto the letterboxed frame, in place.
+ *
+ * Coordinates are shifted and scaled from the letterbox region to [0, 1] of
+ * the frame and clamped, so anything drawn on the border ends at the frame edge.
+ *
+ * @return False when the frame was not letterboxed or the detection is not normalized.
+ */
+bool unletterboxDetectionInPlace(Detection& detection, const FrameMetadata& metadata);
+
+
 /**
  * @brief Writes an image-space copy of a normalized detection.
  */
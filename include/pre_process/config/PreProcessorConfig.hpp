@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include "core/enums.hpp"
 #include "pre_process/utils/enums.hpp"
@@ -19,13 +20,27 @@ struct PreProcessorConfig {
     ///< Input channel interpretation and output tensor geometry.
     ChannelOrderType imgRgbOrdering;
     size_t imgResizeHeight, imgResizeWidth, numImgChannels;
-    ///< Output tensor scalar type.
+    ///< Output tensor scalar type and layout; UInt8 leaves normalization to the model.
     DataType outputDataType;
+    TensorLayoutType tensorLayout = TensorLayoutType::NCHW;
     
-    ///< Normalization parameters passed to OpenCV blob creation.
+    ///< Normalization: output = (pixel - mean) * imgScalingFactor.
     double imgScalingFactor = 1.0f;
+    ///< Mean of the first output channel only, as cv::Scalar(imgMean) gives blobFromImages.
     double imgMean = 0.0f;
+    ///< Per-output-channel means; when set (3 values), replaces imgMean.
+    std::vector<float> imgChannelMeans;
+    ///< Int8 output only: q = saturate(round(output / quantScale) + quantZeroPoint).
+    float quantScale = 0.0f;
+    int quantZeroPoint = 0;
     
+    ///< Fitting of frames to imgResizeWidth x imgResizeHeight, and the letterbox border pixel value.
+    ResizeModeType resizeMode = ResizeModeType::STRETCH;
+    double letterboxPadValue = 114.0;
+
+    ///< Threads converting the images of a batch concurrently; 0 converts them in the calling thread.
+    size_t imageThreads = 0;
+
     ///< Expected input tensor rank by tensor name.
     std::unordered_map<std::string, int> ndimsOfInputs;
 
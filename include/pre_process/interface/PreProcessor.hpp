@@ -13,11 +13,12 @@ class PreProcessor {
 
         /**
          * @brief Preprocess a batch of frames into output tensor views.
-         * @param inputData Batch images and metadata from FrameSource.
+         * @param inputData Batch images and metadata from FrameSource; preprocessors
+         *        record how each frame was fitted to the input in its metadata.
          * @param resultBufferViews Output tensor views keyed by tensor name.
          */
         virtual void process(
-            const BatchFrameData& inputData,
+            BatchFrameData& inputData,
             TensorViewMap& resultBufferViews
         ) = 0;
 };
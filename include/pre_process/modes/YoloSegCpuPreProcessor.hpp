@@ -1,10 +1,13 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include "pre_process/interface/PreProcessor.hpp"
 #include "pre_process/config/PreProcessorConfig.hpp"
 #include "memory_management/enums.hpp"
+#include "core/ThreadPool.hpp"
+#include "pre_process/utils/PreProcessUtils.hpp"
 
 
 /**
@@ -13,14 +16,25 @@
 struct YoloSegCpuPreProcessorSettings {
     static constexpr std::string_view ImageKey = "images";
     static constexpr TensorGroup inputTensorGroup = TensorGroup::HostInput;
-    static constexpr std::array<DataType, 2> supportedTypes = {DataType::Float16, DataType::Float32};
+    static constexpr std::array<DataType, 4> supportedTypes = {
+        DataType::Float16, DataType::Float32, DataType::UInt8, DataType::Int8
+    };
 };
 
 /**
  * @brief CPU OpenCV preprocessor for YOLO segmentation models.
  *
- * Produces the `images` tensor using OpenCV blob creation and writes directly
- * into the configured tensor buffer view.
+ * Produces the `images` tensor with the fused createBlob4D kernel, which
+ * writes FP32 or FP16 directly into the configured tensor buffer view.
+ * UInt8 output skips normalization, which the model then performs, and
+ * can also be written interleaved (NHWC). Int8 output is normalized and
+ * then quantized with `quantScale` and `quantZeroPoint` in the same pass.
+ * With `imageThreads > 0`, the images of a batch are converted as separate
+ * tasks on a pool owned by the preprocessor, each into its own slice.
+ *
+ * In letterbox mode, each frame keeps its aspect ratio and is centered in
+ * the input with a `letterboxPadValue` border. The placement is recorded in
+ * the frame metadata so postprocessing can map detections back to the frame.
  */
 class YoloSegCpuPreProcessor : public PreProcessor {
 
@@ -35,14 +49,20 @@ class YoloSegCpuPreProcessor : public PreProcessor {
          * @copydoc PreProcessor::process
          */
         void process(
-            const BatchFrameData& inputData,
+            BatchFrameData& inputData,
             TensorViewMap& resultBufferViews
         ) override;
 
     private:
-        float m_scale, m_mean;
+        float m_scale;
+        std::array<float, 3> m_channelMeans;
         bool m_isBGR;
         int m_nBatchDims;
         size_t m_outImgH, m_outImgW;
+        ResizeModeType m_resizeMode;
+        float m_letterboxPadValue;
         DataType m_dtype;
+        TensorLayoutType m_layout;
+        Quantization m_quantization;
+        std::unique_ptr<ThreadPool> m_imagePool;
 };
@@ -1,27 +1,236 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <future>
 #include <vector>
 #include <type_traits>
 #include <opencv2/core.hpp>
 #include <opencv2/opencv.hpp>
 
+#include "core/ThreadPool.hpp"
+#include "core/tensor.hpp"
+
+/**
+ * @brief Placement of a letterboxed image inside the output planes.
+ */
+struct Letterbox {
+    ///< Output pixels per source pixel, the same along both axes.
+    double scale = 1.0;
+    ///< Top-left corner and size of the scaled image; everything else is border.
+    int x = 0, y = 0;
+    int width = 0, height = 0;
+};
+
+/**
+ * @brief Per-tensor affine quantization of normalized values to INT8.
+ *
+ * As ONNX QuantizeLinear: `q = saturate(round(x / scale) + zeroPoint)`,
+ * rounding halves to even, computed in FP32.
+ */
+struct Quantization {
+    float scale = 1.0f;
+    int zeroPoint = 0;
+};
+
+/**
+ * @brief Allows or forbids the AVX2/F16C conversion kernels.
+ *
+ * They are allowed by default and used when compiled in and supported by
+ * the CPU. Forbidding them forces the scalar fallback, so both paths can be
+ * checked on the same host.
+ */
+void setPreProcessAvx2Enabled(bool enabled);
+
+/**
+ * @brief Whether conversions currently take the AVX2/F16C path.
+ */
+bool preProcessAvx2Active();
+
+/**
+ * @brief Letterbox of a `srcWidth x srcHeight` image in `width x height` planes.
+ *
+ * Scales by min(width / srcWidth, height / srcHeight), rounds the scaled size
+ * and centers it. An odd border puts the extra pixel on the right or bottom,
+ * as in the Ultralytics letterbox.
+ */
+Letterbox computeLetterbox(int srcWidth, int srcHeight, int width, int height);
+
+/**
+ * @brief Writes one image into a planar CHW tensor in a single pass.
+ *
+ * Equivalent to one image of cv::dnn::blobFromImages with ddepth CV_32F,
+ * followed by convertTo for FP16, without the intermediate FP32 blob. The
+ * image is resized with INTER_LINEAR into a reused per-thread buffer unless
+ * it already has the target size. Each pixel is then read once and written
+ * as `(pixel - channelMeans[c]) * scale` into plane c, with B and R swapped
+ * when `swapRB` is set.
+ *
+ * Given a letterbox, the image is resized to the letterbox size and written
+ * at its offset. Only the border around it is filled, with `padValue`
+ * converted like a pixel, so the result matches blobFromImages of the padded
+ * 8-bit image without building it.
+ *
+ * For `uint8_t` output, as for blobFromImages with CV_8U, normalization is
+ * left to the model: `channelMeans` must be zero and `scale` one, and
+ * pixels are only resized, reordered and deinterleaved. For `int8_t`
+ * output, the normalized values are quantized in the same pass.
+ *
+ * The inner loop uses AVX2/F16C when compiled with YOLO_ENABLE_AVX2 and the
+ * CPU supports it, with a scalar fallback. Both give the same results as
+ * OpenCV: FP32 arithmetic, and round-to-nearest-even for FP16.
+ *
+ * @param image CV_8UC3 input image; rows may be padded.
+ * @param height Output plane height.
+ * @param width Output plane width.
+ * @param letterbox Placement inside the planes, or null to stretch the image over them.
+ * @param padValue Pixel value of the letterbox border.
+ * @param channelMeans Mean subtracted from each output channel.
+ * @param scale Factor applied after mean subtraction.
+ * @param swapRB Whether to swap the first and last channels.
+ * @param dst Start of the image's `3 * height * width` elements.
+ */
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    float* dst
+);
+
+/**
+ * @copydoc fillBlobImage
+ */
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    cv::float16_t* dst
+);
+
+/**
+ * @copydoc fillBlobImage
+ */
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    uint8_t* dst
+);
+
+/**
+ * @brief Writes one image into a planar CHW INT8 tensor, quantizing the normalized values.
+ *
+ * Same pass as fillBlobImage(); each `(pixel - channelMeans[c]) * scale`,
+ * and the letterbox border, is quantized with `quantization`.
+ *
+ * @throws std::runtime_error if the quantization scale is not positive or
+ *         the zero point is outside [-128, 127].
+ */
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    const Quantization& quantization,
+    int8_t* dst
+);
+
+/**
+ * @brief Writes one image into an interleaved HWC 8-bit tensor.
+ *
+ * Resizes and letterboxes like fillBlobImage(), then copies rows straight
+ * into the tensor, swapping B and R per pixel when `swapRB` is set.
+ *
+ * @param image CV_8UC3 input image; rows may be padded.
+ * @param height Output height.
+ * @param width Output width.
+ * @param letterbox Placement inside the output, or null to stretch the image over it.
+ * @param padValue Value of every channel of the letterbox border.
+ * @param swapRB Whether to swap the first and last channels.
+ * @param dst Start of the image's `height * width * 3` bytes.
+ */
+void fillInterleavedImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    uint8_t padValue,
+    bool swapRB,
+    uint8_t* dst
+);
+
+/**
+ * @brief Runs `convertImage(i)` for every image of a batch, on `imagePool` when given.
+ *
+ * Images are written to disjoint slices, so tasks need no synchronization.
+ * Failures are rethrown once every task has finished.
+ */
+template <typename F>
+void forEachBatchImage(size_t numImages, ThreadPool* imagePool, const F& convertImage) {
+
+    if (imagePool == nullptr || numImages < 2) {
+        for (size_t i = 0; i < numImages; ++i) {
+            convertImage(i);
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> pending;
+    pending.reserve(numImages);
+    for (size_t i = 0; i < numImages; ++i) {
+        pending.push_back(imagePool->submit([&convertImage, i]() { convertImage(i); }));
+    }
+
+    // Every task borrows the inputs and the tensor, so wait for all before rethrowing a failure.
+    for (std::future<void>& task : pending) {
+        task.wait();
+    }
+    for (std::future<void>& task : pending) {
+        task.get();
+    }
+}
 
 /**
  * @brief Creates a 4D NCHW OpenCV blob directly over a tensor buffer view.
  *
  * The destination tensor must already own enough memory for
- * `batchSize * numChannels * height * width` elements of type `T`.
+ * `batchSize * numChannels * height * width` elements of type `T`. Each
+ * image is written straight into its own NCHW slice by fillBlobImage(), so
+ * images are independent and, given `imagePool`, converted concurrently.
  *
- * @tparam T Output element type. Supported types are `float` and `cv::float16_t`.
+ * @tparam T Output element type. Supported types are `float`, `cv::float16_t`, `uint8_t` and `int8_t`.
  * @param inputImages Input OpenCV images for the batch.
  * @param batchSize Number of images in the batch.
- * @param numChannels Number of output channels.
+ * @param numChannels Number of output channels; must be 3.
  * @param height Output tensor height.
  * @param width Output tensor width.
- * @param mean Mean value passed to OpenCV blob conversion.
- * @param scale Scale factor passed to OpenCV blob conversion.
- * @param isBGR Whether OpenCV should keep BGR channel order.
+ * @param channelMeans Mean subtracted from each output channel.
+ * @param scale Scale factor applied after mean subtraction.
+ * @param swapRB Whether to swap the first and last channels.
+ * @param letterboxes Per-image letterbox placements, or empty to stretch every image.
+ * @param padValue Pixel value of the letterbox border.
  * @param resultTensor Destination tensor view.
+ * @param imagePool Optional pool running one task per image; null converts them in the calling thread.
+ * @param quantization Quantization of `int8_t` output; ignored for other types.
  * @return OpenCV matrix header pointing at the destination tensor storage.
  */
 template <typename T>
@@ -31,15 +240,21 @@ cv::Mat createBlob4D(
     int numChannels,
     int height,
     int width,
-    float mean,
+    const std::array<float, 3>& channelMeans,
     float scale,
-    bool isBGR,
-    TensorView& resultTensor
+    bool swapRB,
+    const std::vector<Letterbox>& letterboxes,
+    float padValue,
+    TensorView& resultTensor,
+    ThreadPool* imagePool = nullptr,
+    const Quantization& quantization = {}
 ) {
 
     static_assert(
         std::is_same_v<T, float> ||
-        std::is_same_v<T, cv::float16_t>,
+        std::is_same_v<T, cv::float16_t> ||
+        std::is_same_v<T, uint8_t> ||
+        std::is_same_v<T, int8_t>,
         "Unsupported blob type"
     );
 
@@ -48,39 +263,64 @@ cv::Mat createBlob4D(
     if (!batchData) {
         throw std::runtime_error("Uninitialized Memory for input to the model.");
     }
-
-    int dims[] = {batchSize, numChannels, height, width};
-    cv::Mat processedBatch(4, dims, cv::DataType<T>::type, batchData);
-
-    if constexpr (std::is_same_v<T, cv::float16_t>) {
-        
-        cv::Mat blobFP32;
-        cv::dnn::blobFromImages(
-            inputImages,
-            blobFP32,
-            scale,
-            cv::Size(width, height),
-            cv::Scalar(mean),
-            isBGR,
-            false,
-            CV_32F
-        );
-
-        blobFP32.convertTo(processedBatch, cv::DataType<T>::type);
-
-    } else {
-        
-        cv::dnn::blobFromImages(
-            inputImages,
-            processedBatch,
-            scale,
-            cv::Size(width, height),
-            cv::Scalar(mean),
-            isBGR,
-            false,
-            CV_32F
-        );
+    if (numChannels != 3) {
+        throw std::runtime_error("Blob creation expects 3 channels.");
     }
+    if (inputImages.size() > static_cast<size_t>(batchSize)) {
+        throw std::runtime_error("More input images than the batch holds.");
+    }
+    if (!letterboxes.empty() && letterboxes.size() != inputImages.size()) {
+        throw std::runtime_error("Letterbox placements do not match the input images.");
+    }
+
+    const size_t imageElems = static_cast<size_t>(numChannels) * height * width;
+    const auto convertImage = [&](size_t i) {
+        const Letterbox* letterbox = letterboxes.empty() ? nullptr : &letterboxes[i];
+        if constexpr (std::is_same_v<T, int8_t>) {
+            fillBlobImage(
+                inputImages[i], height, width, letterbox, padValue,
+                channelMeans, scale, swapRB, quantization, batchData + i * imageElems
+            );
+        } else {
+            fillBlobImage(
+                inputImages[i], height, width, letterbox, padValue,
+                channelMeans, scale, swapRB, batchData + i * imageElems
+            );
+        }
+    };
 
-    return processedBatch;
+    forEachBatchImage(inputImages.size(), imagePool, convertImage);
+
+    int dims[] = {batchSize, numChannels, height, width};
+    return cv::Mat(4, dims, cv::DataType<T>::type, batchData);
 }
+
+/**
+ * @brief Creates a 4D NHWC 8-bit OpenCV blob directly over a tensor buffer view.
+ *
+ * Interleaved counterpart of createBlob4D() for models taking raw `uint8`
+ * NHWC input. Each image is written by fillInterleavedImage() into its own
+ * slice, given `imagePool`, concurrently.
+ *
+ * @param inputImages Input OpenCV images for the batch.
+ * @param batchSize Number of images in the batch.
+ * @param height Output tensor height.
+ * @param width Output tensor width.
+ * @param swapRB Whether to swap the first and last channels.
+ * @param letterboxes Per-image letterbox placements, or empty to stretch every image.
+ * @param padValue Value of every channel of the letterbox border.
+ * @param resultTensor Destination `UInt8` tensor view.
+ * @param imagePool Optional pool running one task per image; null converts them in the calling thread.
+ * @return OpenCV matrix header pointing at the destination tensor storage.
+ */
+cv::Mat createInterleavedBlob4D(
+    const std::vector<cv::Mat>& inputImages,
+    int batchSize,
+    int height,
+    int width,
+    bool swapRB,
+    const std::vector<Letterbox>& letterboxes,
+    uint8_t padValue,
+    TensorView& resultTensor,
+    ThreadPool* imagePool = nullptr
+);
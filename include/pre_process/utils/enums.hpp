@@ -7,3 +7,23 @@ enum class ChannelOrderType {
     RGB,
     BGR,
 };
+
+/**
+ * @brief How frames are fitted to the network input size.
+ */
+enum class ResizeModeType {
+    /** Scale width and height independently to fill the input. */
+    STRETCH,
+    /** Scale by one factor to fit inside the input and pad the rest. */
+    LETTERBOX,
+};
+
+/**
+ * @brief Memory layout of the preprocessed image tensor.
+ */
+enum class TensorLayoutType {
+    /** Planar channels, [batch, channel, height, width]. */
+    NCHW,
+    /** Interleaved channels, [batch, height, width, channel]; 8-bit output only. */
+    NHWC,
+};
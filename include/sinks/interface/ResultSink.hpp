@@ -4,6 +4,7 @@
 
 #include "logging/BaseLogger.hpp"
 #include "core/cuda.hpp"
+#include "instrumentation/MetricsRegistry.hpp"
 #include "post_process/utils/PostProcessUtils.hpp"
 
 /**
@@ -32,6 +33,14 @@ class ResultSink {
             
             for (auto& output : outputBatch ){
                 consumeSingle(output, logger);
+                if (!output.metadata.isPadding) {
+                    m_framesConsumed.increment();
+                }
             }
         }
+
+    private:
+        Counter& m_framesConsumed = MetricsRegistry::global().counter(
+            "yoloseg_sink_frames_total", "Source frames consumed by the result sink."
+        );
 };
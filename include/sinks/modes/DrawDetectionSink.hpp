@@ -27,4 +27,10 @@ class DrawDetectionSink : public ResultSink {
     private:
         bool m_drawBoxes, m_drawMasks, m_drawContours;
         int m_lineThickness;
+        Counter& m_filesWritten = MetricsRegistry::global().counter(
+            "yoloseg_sink_files_written_total", "Result files written by sinks.", "sink=\"draw\""
+        );
+        Counter& m_bytesWritten = MetricsRegistry::global().counter(
+            "yoloseg_sink_bytes_written_total", "Bytes of result files written by sinks.", "sink=\"draw\""
+        );
 };
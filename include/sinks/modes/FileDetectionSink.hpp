@@ -23,4 +23,10 @@ class FileDetectionSink : public ResultSink {
 
     private:
         bool m_saveNormalized;
+        Counter& m_filesWritten = MetricsRegistry::global().counter(
+            "yoloseg_sink_files_written_total", "Result files written by sinks.", "sink=\"file\""
+        );
+        Counter& m_bytesWritten = MetricsRegistry::global().counter(
+            "yoloseg_sink_bytes_written_total", "Bytes of result files written by sinks.", "sink=\"file\""
+        );
 };
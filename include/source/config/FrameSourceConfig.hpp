@@ -7,13 +7,47 @@
 namespace fs = std::filesystem;
 
 /**
- * @brief Configuration for folder or video frame sources.
+ * @brief Configuration for frame sources.
  */
 struct FrameSourceConfig {
     ///< Source implementation to create.
     FrameSourceType frameSourceType;
-    ///< Folder path or video file path.
+    ///< Folder path, video file path, manifest file or directory, raw packed file, or shared-memory name.
     fs::path sourcePath;
     ///< Original frame geometry and batch size.
     size_t imgHeight, imgWidth, batchSize;
+    ///< Folder sources: decoder threads; video sources: any value starts one decode-ahead thread. 0 decodes in read().
+    size_t decodeThreads = 0;
+    ///< Frames decoded ahead of read(), 0 picks batchSize + 2 * decodeThreads (folder) or 2 * batchSize (video).
+    size_t readAheadFrames = 0;
+    ///< Folder sources: decode at 1/2, 1/4 or 1/8 resolution when that still covers the decode target.
+    bool reducedDecode = false;
+    ///< Preprocessing input geometry the decoded image must cover.
+    size_t decodeTargetHeight = 0, decodeTargetWidth = 0;
+    ///< Folder sources: load files with one read() or as a populated mmap.
+    FileReadMode fileReadMode = FileReadMode::READ;
+    ///< Folder sources: files beyond the decode front given a readahead hint, 0 disables hints.
+    size_t prefetchFiles = 0;
+    ///< Recycled frame buffers; must exceed the frames alive at once downstream. 0 allocates every frame.
+    size_t framePoolSize = 0;
+    ///< Manifest sources: entries [startOffset, endOffset) are read; endOffset 0 reads to the end.
+    size_t startOffset = 0, endOffset = 0;
+    ///< Synthetic sources: generated content.
+    SyntheticPattern syntheticPattern = SyntheticPattern::SHAPES;
+    ///< Synthetic sources: frames to generate, 0 runs until stopped.
+    size_t syntheticFrameCount = 0;
+    ///< Synthetic sources: target frame rate, 0 generates as fast as possible.
+    double syntheticFps = 0.0;
+    ///< Shared-memory sources: end the stream after this long without a frame, 0 waits forever.
+    size_t sharedMemoryTimeoutMs = 0;
+    ///< Video sources: keep every Nth frame; skipped frames are grabbed but not decoded.
+    size_t videoFrameStride = 1;
+    ///< Video sources: keep at most this many frames per second of video, 0 keeps every strided frame.
+    double videoTargetFps = 0.0;
+    ///< Video sources: frames with timestamps in [videoStartMs, videoEndMs) are read; videoEndMs 0 reads to the end.
+    size_t videoStartMs = 0, videoEndMs = 0;
+    ///< Video sources: parallel captures decoding separate chunks, for offline runs; 0 or 1 uses one capture.
+    size_t videoDecodeSegments = 0;
+    ///< Video sources: frames per chunk with videoDecodeSegments > 1; up to (segments + 1) chunks are buffered.
+    size_t videoSegmentFrames = 128;
 };
@@ -3,6 +3,10 @@
 #include "source/config/FrameSourceConfig.hpp"
 #include "source/interface/FrameSource.hpp"
 #include "source/modes/FolderFrameSource.hpp"
+#include "source/modes/ManifestFrameSource.hpp"
+#include "source/modes/RawPackedFrameSource.hpp"
+#include "source/modes/SharedMemoryFrameSource.hpp"
+#include "source/modes/SyntheticFrameSource.hpp"
 #include "source/modes/VideoFrameSource.hpp"
 
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "source/utils/frame.hpp"
+#include "source/utils/FramePool.hpp"
+#include "instrumentation/MetricsRegistry.hpp"
 #include "logging/BaseLogger.hpp"
 
 
@@ -26,57 +28,97 @@ class FrameSource {
         
         /**
          * @brief Read a full batch of frames.
-         * @param batch Destination batch; cleared before reading.
+         *
+         * Frames are swapped into the batch's existing elements, so metadata
+         * is never copied and the previous batch's path and string buffers
+         * are recycled by the next read.
+         *
+         * @param batch Destination batch; overwritten in place.
          * @param logger Logger for source diagnostics.
          * @return true if a full batch was read; false if the source ended early.
          */
         bool readBatch(BatchFrameData& batch, BaseLogger& logger) {
 
-            batch.images.clear();
-            batch.metas.clear();
-            batch.images.reserve(m_batchSize);
-            batch.metas.reserve(m_batchSize);
-            
-            Frame tmpFrame;
+            batch.images.resize(m_batchSize);
+            batch.metas.resize(m_batchSize);
 
             for (size_t i = 0; i < m_batchSize; i++) {
             
-                if (!read(tmpFrame, logger)) {
+                if (!read(m_scratchFrame, logger)) {
                     return false;
                 }
 
-                batch.images.push_back(tmpFrame.image);
-                batch.metas.push_back(tmpFrame.metadata);
+                if (m_scratchFrame.metadata.isPadding) {
+                    m_paddingFramesRead.increment();
+                } else {
+                    m_framesRead.increment();
+                }
+
+                std::swap(batch.images[i], m_scratchFrame.image);
+                std::swap(batch.metas[i], m_scratchFrame.metadata);
 
+                // Drop the previous batch's image so its pool slot can be reused.
+                m_scratchFrame.image.release();
             }
 
             return true;
         }
 
+        /**
+         * @brief Hand a batch's buffers back to the source once preprocessing is done with its pixels.
+         *
+         * Sources that lend out external memory, such as a shared-memory
+         * ring, reclaim it here and release the batch's images. The default
+         * does nothing. May be called from another thread than readBatch(),
+         * and for batches in any order.
+         */
+        virtual void releaseBatch(BatchFrameData& batch) {
+            (void)batch;
+        }
+
     protected:
         /**
          * @brief Construct shared source state.
          * @param imgHeight Frame height used for zero padding frames.
          * @param imgWidth Frame width used for zero padding frames.
          * @param batchSize Number of frames per batch.
+         * @param framePoolSize Recycled frame buffers, 0 to allocate every frame.
          */
-        FrameSource(size_t imgHeight, size_t imgWidth, size_t batchSize):
+        FrameSource(size_t imgHeight, size_t imgWidth, size_t batchSize, size_t framePoolSize = 0):
             m_imgHeight(imgHeight),
             m_imgWidth(imgWidth),
-            m_batchSize(batchSize) {}
+            m_batchSize(batchSize),
+            m_framePool(framePoolSize) {}
 
         /**
-         * @brief Create a black frame with configured source dimensions.
+         * @brief Black frame with configured source dimensions.
+         *
+         * Every call returns the same shared buffer, which must not be written.
          * @return CV_8UC3 zero image.
          */
         cv::Mat zeros() {
-            return cv::Mat::zeros(
-                static_cast<int>(m_imgHeight),
-                static_cast<int>(m_imgWidth),
-                CV_8UC3
-            );
+            if (m_zeroFrame.empty()) {
+                m_zeroFrame = cv::Mat::zeros(
+                    static_cast<int>(m_imgHeight),
+                    static_cast<int>(m_imgWidth),
+                    CV_8UC3
+                );
+            }
+            return m_zeroFrame;
         }
     
     protected:
         size_t m_imgHeight, m_imgWidth, m_batchSize;
+        FramePool m_framePool;
+
+    private:
+        Frame m_scratchFrame;
+        cv::Mat m_zeroFrame;
+
+        Counter& m_framesRead = MetricsRegistry::global().counter(
+            "yoloseg_source_frames_total", "Source frames read, excluding batch padding."
+        );
+        Counter& m_paddingFramesRead = MetricsRegistry::global().counter(
+            "yoloseg_source_padding_frames_total", "Zero frames added to fill the last batch."
+        );
 };
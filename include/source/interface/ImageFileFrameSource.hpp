@@ -0,0 +1,146 @@
+#pragma once
+
+#include <deque>
+#include <future>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "core/ThreadPool.hpp"
+#include "source/config/FrameSourceConfig.hpp"
+#include "source/interface/FrameSource.hpp"
+#include "source/utils/EncodedFileReader.hpp"
+
+
+/**
+ * @brief Base for sources that decode a sequence of encoded image files.
+ *
+ * Subclasses only enumerate file paths through nextFilePath(). Paths are
+ * pulled lazily into a window that spans the files being read, decoded
+ * ahead, and hinted, so memory stays bounded however many files the source
+ * has. Final incomplete batches are padded with zero frames.
+ *
+ * With `decodeThreads > 0`, a thread pool decodes up to `readAheadFrames`
+ * upcoming files concurrently and possibly out of order, while read() still
+ * returns them in enumeration order with unchanged frame ids.
+ *
+ * With `reducedDecode`, images are decoded with the largest
+ * cv::IMREAD_REDUCED_COLOR_{2,4,8} factor whose output still covers the
+ * preprocessing input size, judged from the configured original geometry.
+ * JPEG files are then downscaled in the DCT domain during decoding. The
+ * factor and decoded size are recorded in FrameMetadata; original sizes are
+ * unchanged, so postprocessing maps boxes back exactly as before.
+ *
+ * Files are loaded through EncodedFileReader, either with one bulk read() or
+ * as a populated mmap (`fileReadMode`), and decoded with cv::imdecode into a
+ * frame-pool buffer. With `prefetchFiles > 0`, the next `prefetchFiles` files
+ * beyond those already being decoded get a readahead hint, so slow storage is
+ * read in parallel with decoding.
+ */
+class ImageFileFrameSource : public FrameSource {
+
+    public:
+        /**
+         * @copydoc FrameSource::read
+         */
+        bool read(Frame& frame, BaseLogger& logger) override;
+
+        /**
+         * @brief Reset iteration to the first file, discarding prefetched images.
+         */
+        void reset();
+
+        /**
+         * @brief True for the image extensions file sources accept (.png, .jpg, .jpeg).
+         */
+        static bool isSupportedImageFile(const fs::path& path);
+
+        /**
+         * @brief Supported image files directly inside `folder`, in sorted path order.
+         */
+        static std::vector<fs::path> listImageFiles(const fs::path& folder);
+
+    protected:
+        /**
+         * @brief Set up decoding; subclasses validate their own source path.
+         * @param config Source path, frame dimensions, batch size and decode options.
+         */
+        ImageFileFrameSource(const FrameSourceConfig& config);
+
+        /**
+         * @brief Produce the next file path in read order.
+         * @return false once every file has been enumerated.
+         */
+        virtual bool nextFilePath(fs::path& path) = 0;
+
+        /**
+         * @brief Restart enumeration at the first file.
+         */
+        virtual void rewindFilePaths() = 0;
+
+        /**
+         * @brief True if the source has at least one file; enumerates only the first.
+         */
+        bool hasFiles();
+
+        fs::path m_sourcePath;
+        ///< Frame id of the first file; padding ids continue after the last one.
+        uint64_t m_firstFrameId = FRAME_START;
+
+    private:
+        static constexpr size_t UNKNOWN_FILE_COUNT = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Pull paths until the window holds `count` files or enumeration ends.
+         * @return true if the window holds at least `count` files.
+         */
+        bool fillWindow(size_t count);
+
+        /**
+         * @brief Decoded image for m_currId, taken from the read-ahead window when enabled.
+         */
+        cv::Mat nextDecodedImage();
+
+        /**
+         * @brief Frame-pool buffer sized for the current decode scale.
+         */
+        cv::Mat acquireDecodeBuffer();
+
+        /**
+         * @brief Decode a file into `destination`, reallocating only if its geometry differs.
+         * @return Decoded image, empty if the file could not be read or decoded.
+         */
+        cv::Mat decodeImage(const fs::path& imgPath, int imreadFlags, cv::Mat destination) const;
+
+        /**
+         * @brief Issue readahead hints for files from `decodeFrontId` on, up to m_prefetchFiles of them.
+         */
+        void hintUpcomingFiles(size_t decodeFrontId);
+
+        ///< Paths of files [m_currId, m_currId + m_window.size()). Elements never move,
+        ///< so decode tasks may hold pointers to them until they are popped.
+        std::deque<fs::path> m_window;
+        bool m_pathsExhausted = false;
+        size_t m_totalFiles = UNKNOWN_FILE_COUNT;
+        size_t m_currId = FRAME_START;
+
+        size_t m_decodeScale = 1;
+        int m_imreadFlags = cv::IMREAD_COLOR;
+
+        EncodedFileReader m_fileReader;
+        size_t m_prefetchFiles = 0;
+        size_t m_nextHintId = FRAME_START;
+
+        Counter& m_decodeMicros = MetricsRegistry::global().counter(
+            "yoloseg_source_decode_microseconds_total", "Time image file sources spent decoding loaded files."
+        );
+
+        size_t m_readAheadFrames = 0;
+        size_t m_nextPrefetchId = FRAME_START;
+        std::unique_ptr<ThreadPool> m_decodePool;
+        std::deque<std::future<cv::Mat>> m_pending;
+
+        Counter& m_decodeFailures = MetricsRegistry::global().counter(
+            "yoloseg_source_decode_failures_total", "Source frames that failed to decode and were replaced with zeros."
+        );
+};
@@ -1,16 +1,20 @@
 #pragma once
 
-#include "source/interface/FrameSource.hpp"
+#include <vector>
+
+#include "source/interface/ImageFileFrameSource.hpp"
 #include "source/config/FrameSourceConfig.hpp"
 
 
 /**
- * @brief FrameSource implementation that reads images from a folder.
+ * @brief ImageFileFrameSource that reads images from a folder.
  *
  * Supported file extensions are discovered in the constructor and read in
- * sorted path order. Final incomplete batches are padded with zero frames.
+ * sorted path order. Decoding, read-ahead and padding are described in
+ * ImageFileFrameSource. For very large or nested datasets use
+ * ManifestFrameSource, which does not list or sort the files up front.
  */
-class FolderFrameSource : public FrameSource {
+class FolderFrameSource : public ImageFileFrameSource {
 
     public:
         /**
@@ -19,20 +23,11 @@ class FolderFrameSource : public FrameSource {
          */
         FolderFrameSource(const FrameSourceConfig& config);
 
-        /**
-         * @copydoc FrameSource::read
-         */
-        bool read(Frame& frame, BaseLogger& logger) override;
-
-        /**
-         * @brief Reset iteration to the first frame.
-         */
-        void reset() {
-            m_currId = FRAME_START;
-        }
+    protected:
+        bool nextFilePath(fs::path& path) override;
+        void rewindFilePaths() override;
 
     private:
-        fs::path m_folderPath;
         std::vector<fs::path> m_filesList;
-        size_t m_currId = FRAME_START;
+        size_t m_nextFileIdx = 0;
 };
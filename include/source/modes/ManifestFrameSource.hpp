@@ -0,0 +1,53 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+
+#include "source/interface/ImageFileFrameSource.hpp"
+#include "source/config/FrameSourceConfig.hpp"
+
+
+/**
+ * @brief ImageFileFrameSource that streams file paths instead of listing them up front.
+ *
+ * If the source path is a file, it is read as a newline-delimited manifest:
+ * one image path per line, relative paths resolved against the manifest's
+ * directory, blank lines and lines starting with '#' ignored. If it is a
+ * directory, it is walked recursively and lazily, in directory order, keeping
+ * supported image extensions. Either way only the paths inside the decode
+ * window are held in memory, so the first batch starts immediately.
+ *
+ * `startOffset` and `endOffset` select the entries [startOffset, endOffset)
+ * (endOffset 0 means to the end), so runs can split one manifest into slices.
+ * Frame ids are entry indices in the full manifest.
+ */
+class ManifestFrameSource : public ImageFileFrameSource {
+
+    public:
+        /**
+         * @brief Construct a manifest source.
+         * @param config Manifest file or directory, slice offsets, frame dimensions, and batch size.
+         * @throws std::runtime_error if the path is invalid, the offsets are inverted, or the slice is empty.
+         */
+        ManifestFrameSource(const FrameSourceConfig& config);
+
+    protected:
+        bool nextFilePath(fs::path& path) override;
+        void rewindFilePaths() override;
+
+    private:
+        /**
+         * @brief Next entry of the manifest or walk, ignoring the slice bounds.
+         */
+        bool nextEntry(fs::path& path);
+
+        bool m_walkDirectory = false;
+        fs::recursive_directory_iterator m_walk;
+        std::ifstream m_manifest;
+        fs::path m_manifestDir;
+        std::string m_line;
+
+        size_t m_startOffset = 0;
+        size_t m_endOffset = 0;
+        size_t m_nextEntryIdx = 0;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "source/interface/FrameSource.hpp"
+#include "source/config/FrameSourceConfig.hpp"
+
+
+/**
+ * @brief FrameSource over a raw packed frame file (see RawPackedFormat.hpp).
+ *
+ * The file is mapped read-only and each frame is returned as a cv::Mat
+ * header pointing straight into the mapping, so reading costs no decode and
+ * no copy. Frames must not be written, and they are only valid while the
+ * source is alive. Frame geometry must match the configured original size.
+ * Final incomplete batches are padded with zero frames.
+ */
+class RawPackedFrameSource : public FrameSource {
+
+    public:
+        /**
+         * @brief Map a packed file.
+         * @param config Packed file path, frame dimensions, and batch size.
+         * @throws std::runtime_error if the file cannot be mapped, is malformed, or its geometry differs.
+         */
+        RawPackedFrameSource(const FrameSourceConfig& config);
+
+        RawPackedFrameSource(const RawPackedFrameSource&) = delete;
+        RawPackedFrameSource& operator=(const RawPackedFrameSource&) = delete;
+
+        ~RawPackedFrameSource();
+
+        /**
+         * @copydoc FrameSource::read
+         */
+        bool read(Frame& frame, BaseLogger& logger) override;
+
+        /**
+         * @brief Number of frames in the file, excluding padding.
+         */
+        size_t getTotalFrames() const {
+            return m_frameCount;
+        }
+
+    private:
+        fs::path m_packedPath;
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0;
+        const uchar* m_frames = nullptr;
+        size_t m_frameCount = 0;
+        size_t m_frameBytes = 0;
+        size_t m_currId = FRAME_START;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "source/interface/FrameSource.hpp"
+#include "source/config/FrameSourceConfig.hpp"
+#include "source/utils/SharedFrameRing.hpp"
+
+
+/**
+ * @brief FrameSource that reads frames from a producer's shared-memory ring.
+ *
+ * Attaches to the POSIX shared-memory object named by the source path, with
+ * the layout described in SharedFrameRing.hpp. Slots are wrapped as cv::Mat
+ * headers without copying, and stay owned by this source until releaseBatch()
+ * hands them back to the producer after preprocessing. The ring therefore
+ * needs at least `batchSize` slots. Extra slots let the producer run ahead
+ * while batches move through the pipeline.
+ *
+ * read() blocks until the producer publishes a frame. The stream ends when
+ * the producer closes the ring, or after `sharedMemoryTimeoutMs` without a
+ * new frame if that is non-zero. The last batch is then padded with zero
+ * frames. Frame ids and timestamps come from the producer.
+ */
+class SharedMemoryFrameSource : public FrameSource {
+
+    public:
+        /**
+         * @brief Attach to a ring created by the producer.
+         * @param config Shared-memory object name, batch size and idle timeout.
+         * @throws std::runtime_error if the object is missing, malformed, or has fewer slots than batchSize.
+         */
+        SharedMemoryFrameSource(const FrameSourceConfig& config);
+
+        SharedMemoryFrameSource(const SharedMemoryFrameSource&) = delete;
+        SharedMemoryFrameSource& operator=(const SharedMemoryFrameSource&) = delete;
+
+        ~SharedMemoryFrameSource();
+
+        /**
+         * @copydoc FrameSource::read
+         */
+        bool read(Frame& frame, BaseLogger& logger) override;
+
+        /**
+         * @copydoc FrameSource::releaseBatch
+         */
+        void releaseBatch(BatchFrameData& batch) override;
+
+    private:
+        /**
+         * @brief Wait for sequence m_nextSeq to be published.
+         * @return false once the producer has closed the ring or the idle timeout expired.
+         */
+        bool waitForFrame(BaseLogger& logger);
+
+        fs::path m_ringName;
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0;
+        SharedFrameRingHeader* m_header = nullptr;
+        const uchar* m_slots = nullptr;
+
+        uint64_t m_nextSeq = 0;
+        bool m_ended = false;
+        size_t m_framesRead = 0;
+        uint64_t m_nextPaddingId = FRAME_START;
+        std::chrono::milliseconds m_timeout;
+
+        ///< Guards the release bookkeeping; releaseBatch runs on preprocessing threads.
+        std::mutex m_releaseMutex;
+        std::vector<bool> m_released;
+        uint64_t m_releasedSeq = 0;
+};
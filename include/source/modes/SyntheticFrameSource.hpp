@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+
+#include "source/interface/FrameSource.hpp"
+#include "source/config/FrameSourceConfig.hpp"
+
+
+/**
+ * @brief FrameSource that generates frames in memory instead of reading files.
+ *
+ * Frames have the configured original size and are drawn into frame-pool
+ * buffers, so with `framePoolSize > 0` a long run allocates no pixel memory
+ * after warm-up. Patterns are deterministic per frame id:
+ * - SOLID: one color per frame, cycling through a small palette.
+ * - SHAPES: a rectangle and a circle moving across a gray background.
+ * - NOISE: uniform random pixels seeded by the frame id.
+ *
+ * `syntheticFrameCount` 0 generates frames until the process is stopped.
+ * With `syntheticFps > 0`, read() sleeps so frames are produced no faster
+ * than that rate. Timestamps follow the target rate, or the wall clock when
+ * unthrottled. Finite runs are padded with zero frames to a full batch.
+ */
+class SyntheticFrameSource : public FrameSource {
+
+    public:
+        /**
+         * @brief Construct a synthetic source.
+         * @param config Frame dimensions, batch size, pattern, frame count and rate.
+         */
+        SyntheticFrameSource(const FrameSourceConfig& config);
+
+        /**
+         * @copydoc FrameSource::read
+         */
+        bool read(Frame& frame, BaseLogger& logger) override;
+
+    private:
+        void drawFrame(cv::Mat& image, uint64_t frameId) const;
+
+        SyntheticPattern m_pattern;
+        size_t m_frameCount;
+        double m_fps;
+        size_t m_currId = FRAME_START;
+        std::chrono::steady_clock::time_point m_startTime;
+};
@@ -1,44 +1,151 @@
 #pragma once
 
-#include <opencv2/videoio.hpp> 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <opencv2/videoio.hpp>
 #include "source/interface/FrameSource.hpp"
 #include "source/config/FrameSourceConfig.hpp"
+#include "source/utils/SegmentedVideoDecoder.hpp"
 
 /**
  * @brief FrameSource implementation backed by cv::VideoCapture.
+ *
+ * Stream properties are queried once when the video is opened. Frame ids
+ * are frame indices in the stream and timestamps are derived from them and
+ * the cached FPS, so read() never goes through OpenCV's property interface.
+ * The stream ends when the decoder returns no more frames, and the last
+ * batch is then padded with zero frames.
+ *
+ * Frames can be sampled by `videoFrameStride`, `videoTargetFps` and the
+ * [`videoStartMs`, `videoEndMs`) time range. Skipped frames are only
+ * advanced with VideoCapture::grab(); only kept frames are retrieve()d,
+ * which is where they are converted to BGR and copied out. Kept frames keep
+ * their stream frame ids and timestamps.
+ *
+ * With `decodeThreads > 0`, a dedicated thread decodes into a bounded ring of
+ * up to `readAheadFrames` frames, so decoding overlaps with the rest of the
+ * pipeline. A video is decoded sequentially, so one thread is started
+ * whatever the value. read() then only takes the next frame off the ring.
+ *
+ * With `videoDecodeSegments > 1`, for offline processing, that many captures
+ * decode chunks of `videoSegmentFrames` frames in parallel through
+ * SegmentedVideoDecoder, and frames are merged back into frame order. The
+ * result is the same stream a single capture produces, provided the
+ * container supports exact seeking; otherwise read() throws.
  */
 class VideoFrameSource : public FrameSource {
 
     public:
         /**
          * @brief Construct a video source.
-         * @param config Video path, frame dimensions, and batch size.
+         * @param config Video path, frame dimensions, batch size, decode-ahead and sampling options.
+         * @throws std::runtime_error if the video cannot be opened, the stride is 0, or time-based
+         *         sampling is requested for a video without a frame rate.
          */
         VideoFrameSource(const FrameSourceConfig& config);
 
+        VideoFrameSource(const VideoFrameSource&) = delete;
+        VideoFrameSource& operator=(const VideoFrameSource&) = delete;
+
+        /**
+         * @brief Stop and join the decode-ahead thread, if any.
+         */
+        ~VideoFrameSource();
+
         /**
          * @copydoc FrameSource::read
          */
         bool read(Frame& frame, BaseLogger& logger) override;
 
         /**
-         * @brief Query source video FPS from OpenCV.
-         * @return Frames per second reported by cv::VideoCapture.
+         * @brief Source video FPS reported by OpenCV when the video was opened.
          */
-        double getFPS() {
-            return m_cap.get(cv::CAP_PROP_FPS);
+        double getFPS() const {
+            return m_fps;
         }
 
         /**
-         * @brief Query total frame count from OpenCV.
-         * @return Number of frames reported by cv::VideoCapture.
+         * @brief Total frame count reported by OpenCV when the video was opened.
+         *
+         * Containers may only estimate this; the stream actually ends when
+         * decoding stops returning frames.
          */
-        size_t getTotalFrames() {
-            return m_cap.get(cv::CAP_PROP_FRAME_COUNT);
+        size_t getTotalFrames() const {
+            return m_totalFrames;
         }
-    
+
     private:
+        struct DecodedFrame {
+            cv::Mat image;
+            size_t frameId = FRAME_START;
+        };
+
+        /**
+         * @brief True if sampling keeps the frame at stream index `frameId`.
+         *
+         * Depends only on `frameId`, so parallel segment decoders agree with a sequential decode.
+         */
+        bool keepFrame(size_t frameId) const;
+
+        /**
+         * @brief Advance to the next kept frame and decode it into a frame-pool buffer.
+         * @return false at end of stream or of the sampled range.
+         */
+        bool decodeFrame(DecodedFrame& frame);
+
+        /**
+         * @brief Decode-ahead thread body: keep the ring filled until end of stream or shutdown.
+         */
+        void decodeLoop();
+
+        /**
+         * @brief Next decoded frame, from the ring when decoding ahead.
+         * @return false at end of stream.
+         */
+        bool nextDecodedFrame(DecodedFrame& frame);
+
         fs::path m_videoPath;
         cv::VideoCapture m_cap;
-        size_t m_paddingFrameId = 0;
+        double m_fps = 0.0;
+        size_t m_totalFrames = 0;
+
+        ///< Sampling, as stream frame indices. m_endFrame is one past the last frame read.
+        size_t m_frameStride = 1;
+        double m_targetFps = 0.0;
+        size_t m_startFrame = 0;
+        size_t m_endFrame = 0;
+        ///< Stream index of the next frame grab() returns.
+        size_t m_streamPos = FRAME_START;
+
+        ///< Parallel chunk decoding; replaces m_cap and the decode-ahead thread when set.
+        std::unique_ptr<SegmentedVideoDecoder> m_segmentDecoder;
+
+        size_t m_framesKept = 0;
+        bool m_ended = false;
+        size_t m_paddedSize = 0;
+        size_t m_nextPaddingId = FRAME_START;
+
+        ///< Ring capacity; 0 decodes in read().
+        size_t m_readAheadFrames = 0;
+        ///< Guards the ring and the flags below, shared with the decode thread.
+        std::mutex m_ringMutex;
+        std::condition_variable m_frameReady;
+        std::condition_variable m_slotFree;
+        std::deque<DecodedFrame> m_decoded;
+        bool m_decodeEnded = false;
+        bool m_stopping = false;
+        std::exception_ptr m_decodeError;
+        std::thread m_decodeThread;
+
+        Counter& m_framesSkipped = MetricsRegistry::global().counter(
+            "yoloseg_source_video_frames_skipped_total", "Video frames grabbed but not decoded because sampling skipped them."
+        );
+        Counter& m_readWaitMicros = MetricsRegistry::global().counter(
+            "yoloseg_source_video_read_wait_microseconds_total", "Time video source reads waited for the decode-ahead thread."
+        );
 };
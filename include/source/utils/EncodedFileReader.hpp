@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+#include <opencv2/core.hpp>
+
+#include "instrumentation/MetricsRegistry.hpp"
+#include "source/utils/enums.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Encoded bytes of one file, valid while the object is alive.
+ *
+ * In MMAP mode the object owns the mapping. In READ mode it points into the
+ * loading thread's reusable buffer, so it is only valid until that thread's
+ * next EncodedFileReader::load().
+ */
+class EncodedFile {
+
+    public:
+        EncodedFile() = default;
+        ~EncodedFile();
+
+        EncodedFile(const EncodedFile&) = delete;
+        EncodedFile& operator=(const EncodedFile&) = delete;
+
+        const uchar* data() const {
+            return m_data;
+        }
+
+        size_t size() const {
+            return m_size;
+        }
+
+        /**
+         * @brief 1xN CV_8U header over the bytes, as expected by cv::imdecode.
+         */
+        cv::Mat asMat() const {
+            return cv::Mat(1, static_cast<int>(m_size), CV_8U, const_cast<uchar*>(m_data));
+        }
+
+        /**
+         * @brief Drop the bytes, unmapping them in MMAP mode.
+         */
+        void release();
+
+    private:
+        friend class EncodedFileReader;
+
+        const uchar* m_data = nullptr;
+        size_t m_size = 0;
+        void* m_mapping = nullptr;
+};
+
+/**
+ * @brief Loads whole encoded image files and hints the kernel about upcoming ones.
+ *
+ * prefetch() issues posix_fadvise(WILLNEED) so the kernel starts reading a file
+ * in the background before the decoder asks for it. load() then reads the file
+ * in one bulk read(), or maps it with MAP_POPULATE in MMAP mode. Either way the
+ * I/O happens inside load(), so the time spent there is the source's I/O wait.
+ *
+ * load() may be called from several decode threads at once.
+ */
+class EncodedFileReader {
+
+    public:
+        explicit EncodedFileReader(FileReadMode mode);
+
+        /**
+         * @brief Ask the kernel to start reading `path` ahead of load(). Failures are ignored.
+         */
+        void prefetch(const fs::path& path) const;
+
+        /**
+         * @brief Load the whole file at `path` into `file`.
+         * @return false if the file could not be opened, is empty, or could not be read.
+         */
+        bool load(const fs::path& path, EncodedFile& file) const;
+
+    private:
+        bool readInto(int fd, size_t size, EncodedFile& file) const;
+        bool mapInto(int fd, size_t size, EncodedFile& file) const;
+
+        FileReadMode m_mode;
+
+        Counter& m_bytesRead = MetricsRegistry::global().counter(
+            "yoloseg_source_bytes_read_total", "Encoded bytes loaded by image file sources."
+        );
+        Counter& m_ioWaitMicros = MetricsRegistry::global().counter(
+            "yoloseg_source_io_wait_microseconds_total", "Time image file sources spent loading encoded files."
+        );
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "instrumentation/MetricsRegistry.hpp"
+
+/**
+ * @brief Fixed-capacity pool of recycled frame buffers.
+ *
+ * acquire() returns a cv::Mat that shares its pixel buffer with a pool slot.
+ * A slot is free again once every other reference to its buffer is dropped,
+ * which the pool detects from the buffer's reference count, so consumers
+ * simply let their Mats go out of scope. Decoders write into the returned Mat
+ * (cv::imdecode with a destination, VideoCapture::read), and OpenCV reuses the
+ * buffer when the size and type match. When every slot is in use the pool
+ * allocates a plain Mat and counts a miss rather than blocking the reader.
+ *
+ * Not thread-safe: acquire() must be called from the reading thread only.
+ * A capacity of 0 disables pooling.
+ */
+class FramePool {
+
+    public:
+        explicit FramePool(size_t capacity);
+
+        /**
+         * @brief Buffer of the requested geometry, recycled when possible.
+         */
+        cv::Mat acquire(int rows, int cols, int type);
+
+        size_t capacity() const {
+            return m_capacity;
+        }
+
+    private:
+        static bool isUnshared(const cv::Mat& slot);
+
+        size_t m_capacity;
+        size_t m_nextSlot = 0;
+        std::vector<cv::Mat> m_slots;
+
+        Counter& m_misses = MetricsRegistry::global().counter(
+            "yoloseg_source_frame_pool_misses_total", "Frames allocated outside the frame pool because every slot was in use."
+        );
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief File header of a raw packed frame file.
+ *
+ * The header is followed, at byte `dataOffset`, by `frameCount` contiguous
+ * BGR8 frames of `height * width * channels` bytes each, row-major without
+ * row padding. All fields are little-endian.
+ */
+struct RawPackedHeader {
+    char magic[8];          ///< RAW_PACKED_MAGIC.
+    uint32_t version;       ///< RAW_PACKED_VERSION.
+    uint32_t channels;      ///< Always 3 (BGR).
+    uint32_t width;         ///< Frame width in pixels.
+    uint32_t height;        ///< Frame height in pixels.
+    uint64_t frameCount;    ///< Number of frames in the file.
+    uint64_t dataOffset;    ///< Offset of the first frame, page aligned.
+};
+
+constexpr char RAW_PACKED_MAGIC[8] = {'Y', 'S', 'R', 'A', 'W', 'P', 'K', '\0'};
+constexpr uint32_t RAW_PACKED_VERSION = 1;
+constexpr uint64_t RAW_PACKED_DATA_OFFSET = 4096;
+
+/**
+ * @brief Convert the images of a folder into one raw packed frame file.
+ *
+ * Files with the extensions accepted by folder sources are read in sorted
+ * path order and resized to `height` x `width` when their size differs.
+ * With `height` or `width` 0, the first image's size is used.
+ *
+ * @return Number of frames written.
+ * @throws std::runtime_error if the folder has no readable images or the output cannot be written.
+ */
+size_t packImageFolder(const fs::path& folder, const fs::path& output, size_t height = 0, size_t width = 0);
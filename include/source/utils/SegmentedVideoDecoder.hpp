@@ -0,0 +1,140 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "instrumentation/MetricsRegistry.hpp"
+#include "source/utils/FramePool.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Decodes one video with several cv::VideoCapture instances in parallel.
+ *
+ * The frame range is split into consecutive chunks of `chunkFrames` frames.
+ * Decoder d opens its own capture and decodes chunks d, d + K, d + 2K, ...,
+ * seeking to the first frame of each one. next() returns frames strictly in
+ * frame order, so callers see the same stream as a single sequential capture.
+ *
+ * At most K + 1 chunks are in flight, so buffered frames stay below
+ * (K + 1) * chunkFrames. Larger chunks mean fewer seeks; each seek decodes
+ * forward from the preceding keyframe.
+ *
+ * The last chunk is open-ended and runs until the capture stops returning
+ * frames, since containers may only estimate their frame count. If a chunk
+ * ends early, the stream ends with it.
+ *
+ * A seek counts as exact when the capture reports the target in POS_FRAMES
+ * and the first frame decoded after it has the target's timestamp, to within
+ * half a frame. Otherwise next() throws rather than return shifted frames.
+ * A refused seek to a frame within the reported count throws as well; only
+ * a capture running out of frames ends the stream early.
+ */
+class SegmentedVideoDecoder {
+
+    public:
+        /**
+         * @brief Open the decoders and start decoding.
+         * @param videoPath Video file to decode.
+         * @param numDecoders Parallel captures K, at least 2.
+         * @param chunkFrames Frames per chunk, at least 1.
+         * @param beginFrame First frame index to decode.
+         * @param endFrame One past the last frame index to decode.
+         * @param expectedFrames Frame count the video reports, used to plan chunks.
+         * @param imgHeight, imgWidth Geometry of the pooled decode buffers.
+         * @param framePoolSize Recycled buffers per decoder, 0 to allocate every frame.
+         * @param keepFrame Sampling predicate; frames it rejects are grabbed but not retrieved.
+         */
+        SegmentedVideoDecoder(
+            const fs::path& videoPath,
+            size_t numDecoders,
+            size_t chunkFrames,
+            size_t beginFrame,
+            size_t endFrame,
+            size_t expectedFrames,
+            size_t imgHeight,
+            size_t imgWidth,
+            size_t framePoolSize,
+            std::function<bool(size_t)> keepFrame
+        );
+
+        SegmentedVideoDecoder(const SegmentedVideoDecoder&) = delete;
+        SegmentedVideoDecoder& operator=(const SegmentedVideoDecoder&) = delete;
+
+        /**
+         * @brief Stop and join the decoders.
+         */
+        ~SegmentedVideoDecoder();
+
+        /**
+         * @brief Next kept frame in frame order.
+         * @return false at end of stream. Decoder errors are rethrown here.
+         */
+        bool next(cv::Mat& image, size_t& frameId);
+
+    private:
+        struct Chunk {
+            std::deque<std::pair<size_t, cv::Mat>> frames;
+            bool done = false;
+            ///< The capture ran out of frames before the chunk's planned end.
+            bool endedEarly = false;
+            std::exception_ptr error;
+        };
+
+        /**
+         * @brief Body of decoder `decoder`: decode its chunks until the range ends or shutdown.
+         */
+        void decodeLoop(size_t decoder);
+
+        /**
+         * @brief Decode chunk `index` into its slot with `cap`.
+         */
+        void decodeChunk(cv::VideoCapture& cap, FramePool& pool, size_t index);
+
+        std::runtime_error inexactSeek(size_t frameId) const;
+
+        /**
+         * @brief Slot of chunk `index`, valid while fewer than K + 1 chunks are in flight.
+         */
+        Chunk& chunkSlot(size_t index) {
+            return m_chunks[index % m_chunks.size()];
+        }
+
+        fs::path m_videoPath;
+        size_t m_numDecoders;
+        size_t m_chunkFrames;
+        size_t m_beginFrame;
+        size_t m_endFrame;
+        size_t m_expectedFrames;
+        size_t m_numChunks;
+        size_t m_imgHeight, m_imgWidth;
+        size_t m_framePoolSize;
+        std::function<bool(size_t)> m_keepFrame;
+
+        ///< Guards the chunk slots, m_readChunk and m_stopping.
+        std::mutex m_mutex;
+        std::condition_variable m_frameReady;
+        std::condition_variable m_chunkFree;
+        std::vector<Chunk> m_chunks;
+        size_t m_readChunk = 0;
+        bool m_stopping = false;
+        std::vector<std::thread> m_decoders;
+
+        Counter& m_framesSkipped = MetricsRegistry::global().counter(
+            "yoloseg_source_video_frames_skipped_total", "Video frames grabbed but not decoded because sampling skipped them."
+        );
+        Counter& m_seeks = MetricsRegistry::global().counter(
+            "yoloseg_source_video_segment_seeks_total", "Seeks made by parallel video decoders to the start of a chunk."
+        );
+};
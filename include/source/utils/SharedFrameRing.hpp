@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include <opencv2/core.hpp>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Shared-memory ring buffer layout used by SharedMemoryFrameSource.
+ *
+ * A POSIX shared-memory object (shm_open name, e.g. "/yoloseg_frames") holds a
+ * SharedFrameRingHeader followed, at `slotsOffset`, by `slotCount` slots of
+ * `slotBytes` bytes each. Each slot starts with a SharedFrameSlotHeader, and
+ * its BGR8 pixels follow at SHARED_FRAME_PIXELS_OFFSET, `stride` bytes per row.
+ *
+ * There is one producer and one consumer. Sequence numbers only grow, and
+ * sequence `s` uses slot `s % slotCount`:
+ * - The producer may fill slot `writeSeq` once `writeSeq - readSeq < slotCount`.
+ *   It writes the slot, then stores `writeSeq + 1` with release ordering.
+ * - The consumer reads slots below `writeSeq` after an acquire load. It stores
+ *   `readSeq + n` with release ordering once the oldest `n` slots are free again.
+ * - After its last frame the producer sets `closed` to 1.
+ *
+ * All fields are native-endian and the counters are lock-free 64-bit atomics,
+ * so producer and consumer must run on the same host.
+ */
+struct SharedFrameRingHeader {
+    char magic[8];                          ///< SHARED_FRAME_RING_MAGIC.
+    uint32_t version;                       ///< SHARED_FRAME_RING_VERSION.
+    uint32_t slotCount;                     ///< Number of slots.
+    uint64_t slotBytes;                     ///< Bytes per slot, header included, multiple of 64.
+    uint64_t slotsOffset;                   ///< Offset of slot 0 from the start of the object.
+    alignas(64) std::atomic<uint64_t> writeSeq;   ///< Slots published by the producer.
+    alignas(64) std::atomic<uint64_t> readSeq;    ///< Slots released by the consumer.
+    alignas(64) std::atomic<uint32_t> closed;     ///< Nonzero once the producer is done.
+};
+
+/**
+ * @brief Per-slot frame description written by the producer.
+ */
+struct SharedFrameSlotHeader {
+    uint64_t frameId;       ///< Producer frame id, reported as FrameMetadata::frameId.
+    uint64_t timestampNs;   ///< Producer timestamp in nanoseconds.
+    uint32_t width;         ///< Frame width in pixels.
+    uint32_t height;        ///< Frame height in pixels.
+    uint32_t stride;        ///< Bytes per pixel row, at least width * 3.
+    uint32_t channels;      ///< Always 3 (BGR).
+};
+
+constexpr char SHARED_FRAME_RING_MAGIC[8] = {'Y', 'S', 'S', 'H', 'R', 'N', 'G', '\0'};
+constexpr uint32_t SHARED_FRAME_RING_VERSION = 1;
+constexpr size_t SHARED_FRAME_PIXELS_OFFSET = 64;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared frame ring needs lock-free 64-bit atomics");
+static_assert(sizeof(SharedFrameSlotHeader) <= SHARED_FRAME_PIXELS_OFFSET, "Slot header overlaps pixels");
+
+/**
+ * @brief Reference producer that creates a ring and publishes frames into it.
+ *
+ * Intended for tests and as an example for capture processes. The shared-
+ * memory object is created on construction and unlinked on destruction.
+ */
+class SharedFrameRingProducer {
+
+    public:
+        /**
+         * @brief Create the shared-memory object `name` with room for `slotCount` frames of up to maxWidth x maxHeight.
+         * @throws std::runtime_error if the object exists already or cannot be created.
+         */
+        SharedFrameRingProducer(const std::string& name, uint32_t slotCount, uint32_t maxWidth, uint32_t maxHeight);
+
+        SharedFrameRingProducer(const SharedFrameRingProducer&) = delete;
+        SharedFrameRingProducer& operator=(const SharedFrameRingProducer&) = delete;
+
+        ~SharedFrameRingProducer();
+
+        /**
+         * @brief Copy a CV_8UC3 image into the next slot, waiting up to `timeout` for the consumer to free one.
+         * @return false if no slot became free in time.
+         * @throws std::runtime_error if the image is not CV_8UC3 or exceeds the slot size.
+         */
+        bool publish(const cv::Mat& image, uint64_t frameId, uint64_t timestampNs, std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Mark the stream finished; the consumer pads and ends after the published frames.
+         */
+        void close();
+
+        /**
+         * @brief Wait up to `timeout` for the consumer to release every published frame.
+         * @return true if the ring drained in time.
+         */
+        bool waitUntilDrained(std::chrono::milliseconds timeout) const;
+
+    private:
+        std::string m_name;
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0;
+        SharedFrameRingHeader* m_header = nullptr;
+        uint32_t m_maxWidth, m_maxHeight;
+};
+
+/**
+ * @brief Publish the images of a folder through a new ring, then wait for the consumer to drain it.
+ *
+ * Images are read in sorted path order and resized to the first image's
+ * size. Frame ids are positions in that order.
+ *
+ * @return Number of frames published.
+ * @throws std::runtime_error if the folder has no readable images or the consumer stalls for 60 s.
+ */
+size_t publishImageFolder(const std::string& ringName, const fs::path& folder, uint32_t slotCount);
@@ -7,4 +7,25 @@ enum class FrameSourceType {
     UNSET,
     FOLDER,
     VIDEO,
+    MANIFEST,
+    RAW_PACKED,
+    SYNTHETIC,
+    SHARED_MEMORY,
+};
+
+/**
+ * @brief How folder sources load encoded image files.
+ */
+enum class FileReadMode {
+    READ,
+    MMAP,
+};
+
+/**
+ * @brief Frame content produced by synthetic sources.
+ */
+enum class SyntheticPattern {
+    SOLID,
+    SHAPES,
+    NOISE,
 };
@@ -40,11 +40,31 @@ struct FrameMetadata {
     /** @brief Original image channel count. */
     size_t originalChannels = 0;
 
+    /** @brief Width of the decoded image handed to preprocessing, in pixels. */
+    size_t decodedWidth = 0;
+    /** @brief Height of the decoded image handed to preprocessing, in pixels. */
+    size_t decodedHeight = 0;
+    /** @brief Decode-time downscale factor, original / decoded size; 1 for full resolution. */
+    size_t decodeScale = 1;
+    /** @brief Source-internal position used by FrameSource::releaseBatch, e.g. a shared-memory slot sequence. */
+    uint64_t sourceSequence = 0;
+
     /** @brief Network input width in pixels. */
     size_t inputWidth = 0;
     /** @brief Network input height in pixels. */
     size_t inputHeight = 0;
 
+    /** @brief True when preprocessing letterboxed the decoded image into the network input. */
+    bool isLetterboxed = false;
+    /** @brief Letterbox scale, network input pixels per decoded pixel. */
+    double letterboxScale = 1.0;
+    /** @brief Left and top padding of the letterboxed image, in network input pixels. */
+    size_t letterboxPadX = 0;
+    size_t letterboxPadY = 0;
+    /** @brief Size of the scaled image inside the padding, in network input pixels. */
+    size_t letterboxWidth = 0;
+    size_t letterboxHeight = 0;
+
     /** @brief Network output width in pixels. */
     size_t outputWidth = 0;
     /** @brief Network output height in pixels. */
@@ -105,3 +125,12 @@ inline size_t countSourceFrames(const BatchFrameData& batch) {
         }
     ));
 }
+
+/**
+ * @brief Source frame id of the first frame in a batch.
+ * @param batch Batch metadata to inspect.
+ * @return First frame id, or FRAME_START for an empty batch.
+ */
+inline uint64_t firstFrameId(const BatchFrameData& batch) {
+    return batch.metas.empty() ? FRAME_START : batch.metas.front().frameId;
+}
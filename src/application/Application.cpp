@@ -4,35 +4,47 @@
 
 #include "core/yamlParser.hpp"
 #include "application/Application.hpp"
+#include "instrumentation/InferenceStageTimer.hpp"
 #include "source/utils/frame.hpp"
 
-std::vector<std::string> TensorKeys(const TensorViewMap& bufferViews) {
-    std::vector<std::string> keys;
-    keys.reserve(bufferViews.size());
-    for (const auto& [name, tensor] : bufferViews) {
-        keys.push_back(name);
-    }
-    return keys;
-}
-
 Application::Application(const std::filesystem::path& yamlPath):
     Application(loadAppSettingsFromYaml(yamlPath)) {}
 
 Application::Application(const AppSettings& settings):
     m_settings(settings),
-    m_baseLogger(settings.logFilePath, settings.loggingSeverity),
+    m_baseLogger(settings.logFilePath, settings.loggingSeverity, settings.loggingMode, settings.loggingAsyncQueueCapacity),
     m_memManager(TensorGroupConfig{
         .preProcessing = settings.preProcessingTensorGroups,
         .inference = settings.inferenceTensorGroups,
         .postProcessing = settings.postProcessingTensorGroups
-    }) {
+    }, settings.numTensorSlots) {
 
     FrameSourceConfig frameSourceCfg{
         .frameSourceType = settings.frameSourceType,
         .sourcePath = settings.frameSourcePath,
         .imgHeight = settings.origImgHeight,
         .imgWidth = settings.origImgWidth,
-        .batchSize = settings.batchSize
+        .batchSize = settings.batchSize,
+        .decodeThreads = settings.decodeThreads,
+        .readAheadFrames = settings.readAheadFrames,
+        .reducedDecode = settings.reducedDecode,
+        .decodeTargetHeight = settings.imgPreProcessedImgH,
+        .decodeTargetWidth = settings.imgPreProcessedImgW,
+        .fileReadMode = settings.fileReadMode,
+        .prefetchFiles = settings.prefetchFiles,
+        .framePoolSize = settings.framePoolSize,
+        .startOffset = settings.startOffset,
+        .endOffset = settings.endOffset,
+        .syntheticPattern = settings.syntheticPattern,
+        .syntheticFrameCount = settings.syntheticFrameCount,
+        .syntheticFps = settings.syntheticFps,
+        .sharedMemoryTimeoutMs = settings.sharedMemoryTimeoutMs,
+        .videoFrameStride = settings.videoFrameStride,
+        .videoTargetFps = settings.videoTargetFps,
+        .videoStartMs = settings.videoStartMs,
+        .videoEndMs = settings.videoEndMs,
+        .videoDecodeSegments = settings.videoDecodeSegments,
+        .videoSegmentFrames = settings.videoSegmentFrames
     };
 
     PreProcessorConfig preprocessCfg{
@@ -43,8 +55,15 @@ Application::Application(const AppSettings& settings):
         .imgResizeWidth = settings.imgPreProcessedImgW,
         .numImgChannels = StaticSettings::NUM_IMG_CHANNELS,
         .outputDataType = settings.preprocessedDataType,
+        .tensorLayout = settings.imgTensorLayout,
         .imgScalingFactor = settings.imgPreProcessScalingFactor,
         .imgMean = settings.imgPreProcessMeanFactor,
+        .imgChannelMeans = settings.imgPreProcessChannelMeans,
+        .quantScale = settings.imgQuantizationScale,
+        .quantZeroPoint = settings.imgQuantizationZeroPoint,
+        .resizeMode = settings.imgResizeMode,
+        .letterboxPadValue = settings.imgLetterboxPadValue,
+        .imageThreads = settings.preProcessImageThreads,
         .ndimsOfInputs = settings.ndimsOfInputs
     };
 
@@ -52,7 +71,15 @@ Application::Application(const AppSettings& settings):
         .inferBackend = settings.inferenceBackendType,
         .modelType = settings.modelType,
         .processDevice = settings.preferredInferenceDevice,
-        .modelFilePath = settings.serializedModelPath
+        .modelFilePath = settings.serializedModelPath,
+        .numCpuNetworkInstances = settings.numCpuNetworkInstances,
+        .replayLoop = settings.replayLoop,
+        .replayStartFrame = settings.replayStartFrame,
+        .mockFixedLatencyUs = settings.mockFixedLatencyUs,
+        .mockPerItemLatencyUs = settings.mockPerItemLatencyUs,
+        .mockLatencyJitterUs = settings.mockLatencyJitterUs,
+        .mockDetectionsPerFrame = settings.mockDetectionsPerFrame,
+        .mockSeed = settings.mockSeed
     };
 
     PostProcessorConfig postprocessCfg{
@@ -93,37 +120,159 @@ Application::Application(const AppSettings& settings):
 
     m_memManager.allocateAllTensors(settings.inputTensorSpecs);
     m_memManager.allocateAllTensors(settings.outputTensorSpecs);
+    m_memManager.logMemoryUsage(m_baseLogger);
+
+    if (!settings.captureOutputPath.empty()) {
+        const PipelineTensorContext context = m_memManager.createPipelineTensorContext();
+        m_captureWriter = std::make_unique<InferenceCaptureWriter>(
+            settings.captureOutputPath,
+            context.postProcessing.bufferViews.get()
+        );
+    }
 }
 
 void Application::run() {
 
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point startTime = Clock::now();
+
+    if (m_settings.stageStatsEnabled) {
+        m_stageStats = std::make_unique<StageStatistics>();
+    }
+
+    if (!m_settings.traceOutputPath.empty()) {
+        m_traceRecorder = std::make_unique<TraceRecorder>(m_settings.traceEventsPerThread);
+    }
+
+    if (!m_settings.metricsTextfilePath.empty()) {
+        m_metricsExporter = std::make_unique<MetricsTextfileExporter>(
+            MetricsRegistry::global(),
+            m_stageStats.get(),
+            m_settings.metricsTextfilePath,
+            std::chrono::milliseconds(m_settings.metricsExportIntervalMs),
+            m_baseLogger
+        );
+    }
+
+    const PipelineRunStats stats = m_settings.executionMode == ExecutionMode::PIPELINED
+        ? runPipelined()
+        : runSerial();
+
+    const Clock::time_point endTime = Clock::now();
+    const double elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
+    const double totalFps = elapsedSeconds > 0.0
+        ? static_cast<double>(stats.totalSourceFrames) / elapsedSeconds
+        : 0.0;
+
+    m_baseLogger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Total source frames processed: ", stats.totalSourceFrames,
+        ", total batches processed: ", stats.totalBatches,
+        ", elapsed seconds: ", elapsedSeconds,
+        ", total FPS: ", totalFps,
+        '\n'
+    );
+
+    if (m_stageStats) {
+        const fs::path jsonPath = m_settings.stageStatsJsonPath.empty()
+            ? m_settings.resultsDir / "stage_stats.json"
+            : m_settings.stageStatsJsonPath;
+        m_stageStats->logFinalReport(m_baseLogger, jsonPath);
+    }
+
+    if (m_metricsExporter) {
+        m_metricsExporter->stop();
+        m_baseLogger.logConcatMessage(
+            LoggingSeverityType::INFO,
+            "Final metrics written to ", m_settings.metricsTextfilePath.string(), '\n'
+        );
+    }
+
+    if (m_traceRecorder) {
+        m_traceRecorder->write(m_settings.traceOutputPath);
+        m_baseLogger.logConcatMessage(
+            LoggingSeverityType::INFO,
+            "Wrote ", m_traceRecorder->recordedEvents(), " trace span(s) to ",
+            m_settings.traceOutputPath.string(),
+            " (", m_traceRecorder->droppedEvents(), " dropped)\n"
+        );
+    }
+
+    if (m_captureWriter) {
+        m_captureWriter->close();
+        m_baseLogger.logConcatMessage(
+            LoggingSeverityType::INFO,
+            "Captured ", m_captureWriter->numRecords(), " inference output record(s) to ",
+            m_settings.captureOutputPath.string(), '\n'
+        );
+    }
+}
+
+PipelineRunStats Application::runSerial() {
+
     auto bufferContext = m_memManager.createPipelineTensorContext();
     m_inferBackend->bindTensorViewMaps(bufferContext.inference.bindableTensorViews);
 
     const std::vector<std::string> inputKeys = TensorKeys(bufferContext.preProcessing.bufferViews.get());
     const std::vector<std::string> outputKeys = TensorKeys(bufferContext.postProcessing.bufferViews.get());
 
-    using Clock = std::chrono::steady_clock;
-    const Clock::time_point startTime = Clock::now();
-    size_t totalSourceFrames = 0;
-    size_t totalBatches = 0;
+    PipelineRunStats stats;
     size_t batchSize = m_settings.batchSize;
 
     std::vector<PostProcessOutput> processedBatch(batchSize);
 
-    while (m_frameSource->readBatch(m_currBatch, m_baseLogger)) {
+    StageStatistics* stageStats = m_stageStats.get();
+    InferenceStageTimer inferenceTimer(stageStats);
+
+    Counter& batchesCompleted = MetricsRegistry::global().counter(
+        "yoloseg_pipeline_batches_total", "Batches that completed every pipeline stage."
+    );
+
+    TraceRecorder* trace = m_traceRecorder.get();
+    if (trace) {
+        trace->setThreadName("serial");
+    }
+
+    while (true) {
+
+        const uint64_t sequence = stats.totalBatches;
+
+        {
+            ScopedStageTimer readTimer(stageStats, PipelineStage::READ);
+            ScopedTraceSpan readSpan(trace, pipelineStageName(PipelineStage::READ), sequence);
+            if (!m_frameSource->readBatch(m_currBatch, m_baseLogger)) {
+                readTimer.cancel();
+                readSpan.cancel();
+                break;
+            }
+            readTimer.setFrames(countSourceFrames(m_currBatch));
+            readSpan.setFrames(firstFrameId(m_currBatch), countSourceFrames(m_currBatch));
+        }
+
+        const size_t sourceFrames = countSourceFrames(m_currBatch);
+        const uint64_t frameId = firstFrameId(m_currBatch);
 
         for (size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx) {
             m_currBatch.metas[batchIdx].inputWidth = m_settings.imgPreProcessedImgW;
             m_currBatch.metas[batchIdx].inputHeight = m_settings.imgPreProcessedImgH;
             m_currBatch.metas[batchIdx].resultsDir = m_settings.resultsDir;
-            processedBatch[batchIdx].metadata = m_currBatch.metas[batchIdx];
         }
 
-        m_preProcessor->process(m_currBatch, bufferContext.preProcessing.bufferViews.get());
+        {
+            ScopedStageTimer preProcessTimer(stageStats, PipelineStage::PREPROCESS, sourceFrames);
+            ScopedTraceSpan preProcessSpan(trace, pipelineStageName(PipelineStage::PREPROCESS), sequence, frameId, sourceFrames);
+            m_preProcessor->process(m_currBatch, bufferContext.preProcessing.bufferViews.get());
+        }
+
+        // Copied after preprocessing, which records the letterbox placement in the metadata.
+        for (size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx) {
+            processedBatch[batchIdx].metadata = m_currBatch.metas[batchIdx];
+            processedBatch[batchIdx].detections.clear();
+        }
+        m_frameSource->releaseBatch(m_currBatch);
 
-        totalSourceFrames += countSourceFrames(m_currBatch);
-        ++totalBatches;
+        stats.totalSourceFrames += sourceFrames;
+        ++stats.totalBatches;
 
         CudaStream streamHolder;
         if (m_settings.preferredInferenceDevice == PreferredProcessingDevice::PREFER_GPU) {
@@ -131,34 +280,84 @@ void Application::run() {
         }
         cudaStream_t stream = streamHolder.get();
 
-        MemoryManager::transferTensors(bufferContext.preProcessingToInference, inputKeys, stream);
-        m_inferBackend->runInference(
-            bufferContext.inference.inputBufferViews.get(),
-            bufferContext.inference.outputBufferViews.get(),
-            stream
-        );
-        MemoryManager::transferTensors(bufferContext.inferenceToPostProcessing, outputKeys, stream);
+        {
+            ScopedTraceSpan inferenceSpan(trace, pipelineStageName(PipelineStage::INFERENCE), sequence, frameId, sourceFrames);
 
-        if (stream) {
-            CUDA_THROW(cudaStreamSynchronize(stream));
+            inferenceTimer.mark(0, stream);
+            MemoryManager::transferTensors(bufferContext.preProcessingToInference, inputKeys, stream);
+            inferenceTimer.mark(1, stream);
+            m_inferBackend->runInference(
+                bufferContext.inference.inputBufferViews.get(),
+                bufferContext.inference.outputBufferViews.get(),
+                stream
+            );
+            inferenceTimer.mark(2, stream);
+            MemoryManager::transferTensors(bufferContext.inferenceToPostProcessing, outputKeys, stream);
+            inferenceTimer.mark(3, stream);
+
+            if (stream) {
+                CUDA_THROW(cudaStreamSynchronize(stream));
+            }
         }
+        inferenceTimer.record(sourceFrames);
 
-        m_postProcessor->process(bufferContext.postProcessing.bufferViews.get(), processedBatch, m_baseLogger, stream);
-        m_resultSink->consumeBatch(processedBatch, m_baseLogger);
+        if (m_captureWriter) {
+            m_captureWriter->append(bufferContext.postProcessing.bufferViews.get(), m_currBatch.metas);
+        }
+
+        {
+            ScopedStageTimer postProcessTimer(stageStats, PipelineStage::POSTPROCESS, sourceFrames);
+            ScopedTraceSpan postProcessSpan(trace, pipelineStageName(PipelineStage::POSTPROCESS), sequence, frameId, sourceFrames);
+            m_postProcessor->process(bufferContext.postProcessing.bufferViews.get(), processedBatch, m_baseLogger, stream);
+        }
+
+        {
+            ScopedStageTimer sinkTimer(stageStats, PipelineStage::SINK, sourceFrames);
+            ScopedTraceSpan sinkSpan(trace, pipelineStageName(PipelineStage::SINK), sequence, frameId, sourceFrames);
+            m_resultSink->consumeBatch(processedBatch, m_baseLogger);
+        }
+        batchesCompleted.increment();
+
+        if (stageStats && m_settings.stageStatsReportInterval > 0 &&
+            stats.totalBatches % m_settings.stageStatsReportInterval == 0) {
+            stageStats->logIntervalReport(m_baseLogger);
+        }
     }
 
-    const Clock::time_point endTime = Clock::now();
-    const double elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
-    const double totalFps = elapsedSeconds > 0.0
-        ? static_cast<double>(totalSourceFrames) / elapsedSeconds
-        : 0.0;
+    return stats;
+}
 
-    m_baseLogger.logConcatMessage(
-        LoggingSeverityType::INFO,
-        "Total source frames processed: ", totalSourceFrames,
-        ", total batches processed: ", totalBatches,
-        ", elapsed seconds: ", elapsedSeconds,
-        ", total FPS: ", totalFps,
-        '\n'
+PipelineRunStats Application::runPipelined() {
+
+    PipelineExecutorConfig executorCfg{
+        .batchSize = m_settings.batchSize,
+        .inputWidth = m_settings.imgPreProcessedImgW,
+        .inputHeight = m_settings.imgPreProcessedImgH,
+        .resultsDir = m_settings.resultsDir,
+        .inferenceDevice = m_settings.preferredInferenceDevice,
+        .preProcessThreads = m_settings.preProcessThreads,
+        .postProcessThreads = m_settings.postProcessThreads,
+        .preProcessQueueDepth = m_settings.preProcessQueueDepth,
+        .inferenceQueueDepth = m_settings.inferenceQueueDepth,
+        .postProcessQueueDepth = m_settings.postProcessQueueDepth,
+        .sinkQueueDepth = m_settings.sinkQueueDepth,
+        .queueReportInterval = m_settings.queueReportInterval,
+        .statsReportInterval = m_settings.stageStatsReportInterval
+    };
+
+    PipelineExecutor executor(
+        executorCfg,
+        *m_frameSource,
+        *m_preProcessor,
+        *m_inferBackend,
+        *m_postProcessor,
+        *m_resultSink,
+        m_memManager,
+        m_baseLogger,
+        m_captureWriter.get(),
+        m_stageStats.get(),
+        m_traceRecorder.get()
     );
+
+    return executor.run();
 }
@@ -0,0 +1,455 @@
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "application/PipelineExecutor.hpp"
+#include "core/cuda.hpp"
+#include "instrumentation/InferenceStageTimer.hpp"
+
+namespace {
+
+void requirePositive(size_t value, const std::string& name) {
+    if (value == 0) {
+        throw std::runtime_error("Pipeline executor setting must be at least 1: " + name);
+    }
+}
+
+} // namespace
+
+
+PipelineExecutor::StageLink::StageLink(
+    std::string name,
+    size_t producers,
+    size_t consumers,
+    size_t depth
+):
+    m_name(std::move(name)),
+    m_producers(producers),
+    m_consumers(consumers) {
+
+    m_queues.reserve(m_producers * m_consumers);
+    for (size_t i = 0; i < m_producers * m_consumers; ++i) {
+        m_queues.push_back(std::make_unique<SpscQueue<PipelineBatch>>(depth));
+    }
+}
+
+SpscQueue<PipelineBatch>& PipelineExecutor::StageLink::queueFor(size_t sequence) {
+    const size_t producer = sequence % m_producers;
+    const size_t consumer = sequence % m_consumers;
+    return *m_queues[producer * m_consumers + consumer];
+}
+
+bool PipelineExecutor::StageLink::push(PipelineBatch& batch, const std::atomic<bool>& stop) {
+    SpscQueue<PipelineBatch>& queue = queueFor(batch.sequence);
+    SpinBackoff backoff;
+
+    while (!queue.tryPush(batch)) {
+        if (stop.load(std::memory_order_acquire)) {
+            return false;
+        }
+        backoff.pause();
+    }
+    return true;
+}
+
+bool PipelineExecutor::StageLink::pop(
+    size_t sequence,
+    PipelineBatch& batch,
+    const std::atomic<bool>& stop,
+    const std::atomic<size_t>& totalBatches
+) {
+    SpscQueue<PipelineBatch>& queue = queueFor(sequence);
+    SpinBackoff backoff;
+
+    while (!queue.tryPop(batch)) {
+        if (stop.load(std::memory_order_acquire) ||
+            sequence >= totalBatches.load(std::memory_order_acquire)) {
+            return false;
+        }
+        backoff.pause();
+    }
+    return true;
+}
+
+size_t PipelineExecutor::StageLink::occupancy() const {
+    size_t total = 0;
+    for (const auto& queue : m_queues) {
+        total += queue->size();
+    }
+    return total;
+}
+
+size_t PipelineExecutor::StageLink::capacity() const {
+    size_t total = 0;
+    for (const auto& queue : m_queues) {
+        total += queue->capacity();
+    }
+    return total;
+}
+
+const std::string& PipelineExecutor::StageLink::name() const {
+    return m_name;
+}
+
+
+PipelineExecutor::PipelineExecutor(
+    const PipelineExecutorConfig& config,
+    FrameSource& frameSource,
+    PreProcessor& preProcessor,
+    InferenceBackend& inferBackend,
+    PostProcessor& postProcessor,
+    ResultSink& resultSink,
+    MemoryManager& memManager,
+    BaseLogger& logger,
+    InferenceCaptureWriter* captureWriter,
+    StageStatistics* stageStats,
+    TraceRecorder* traceRecorder
+):
+    m_config(config),
+    m_frameSource(frameSource),
+    m_preProcessor(preProcessor),
+    m_inferBackend(inferBackend),
+    m_postProcessor(postProcessor),
+    m_resultSink(resultSink),
+    m_logger(logger),
+    m_captureWriter(captureWriter),
+    m_stageStats(stageStats),
+    m_trace(traceRecorder),
+    m_tensorRing(memManager.createPipelineTensorContextRing()),
+    m_toPreProcess("preprocess", 1, config.preProcessThreads, config.preProcessQueueDepth),
+    m_toInference("inference", config.preProcessThreads, 1, config.inferenceQueueDepth),
+    m_toPostProcess("postprocess", 1, config.postProcessThreads, config.postProcessQueueDepth),
+    m_toSink("sink", config.postProcessThreads, 1, config.sinkQueueDepth),
+    m_occupancy(4),
+    m_totalBatches(std::numeric_limits<size_t>::max()) {
+
+    requirePositive(config.batchSize, "batchSize");
+    requirePositive(config.preProcessThreads, "preProcessThreads");
+    requirePositive(config.postProcessThreads, "postProcessThreads");
+    requirePositive(config.preProcessQueueDepth, "preProcessQueueDepth");
+    requirePositive(config.inferenceQueueDepth, "inferenceQueueDepth");
+    requirePositive(config.postProcessQueueDepth, "postProcessQueueDepth");
+    requirePositive(config.sinkQueueDepth, "sinkQueueDepth");
+
+    const StageLink* links[] = {&m_toPreProcess, &m_toInference, &m_toPostProcess, &m_toSink};
+    for (size_t i = 0; i < m_occupancy.size(); ++i) {
+        m_occupancy[i].depth = &MetricsRegistry::global().gauge(
+            "yoloseg_pipeline_queue_depth",
+            "Batches waiting in a pipeline stage input queue.",
+            "queue=\"" + links[i]->name() + "\""
+        );
+    }
+
+    PipelineTensorContext& firstContext = m_tensorRing->at(0);
+    m_inputKeys = TensorKeys(firstContext.preProcessing.bufferViews.get());
+    m_outputKeys = TensorKeys(firstContext.postProcessing.bufferViews.get());
+    m_inferBackend.bindTensorViewMaps(firstContext.inference.bindableTensorViews);
+
+    if (m_config.inferenceDevice == PreferredProcessingDevice::PREFER_GPU) {
+        m_cudaDevice = currentCudaDevice();
+    }
+}
+
+PipelineRunStats PipelineExecutor::run() {
+
+    m_logger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Starting pipelined execution with ", m_config.preProcessThreads,
+        " preprocess and ", m_config.postProcessThreads, " postprocess workers over ",
+        m_tensorRing->size(), " tensor slot(s).\n"
+    );
+
+    std::vector<std::thread> workers;
+    auto launch = [&](auto&& body) {
+        workers.emplace_back([this, body]() {
+            try {
+                body();
+            } catch (...) {
+                fail(std::current_exception());
+            }
+        });
+    };
+
+    launch([this]() { readWorker(); });
+    for (size_t workerId = 0; workerId < m_config.preProcessThreads; ++workerId) {
+        launch([this, workerId]() { preProcessWorker(workerId); });
+    }
+    launch([this]() { inferenceWorker(); });
+    for (size_t workerId = 0; workerId < m_config.postProcessThreads; ++workerId) {
+        launch([this, workerId]() { postProcessWorker(workerId); });
+    }
+    launch([this]() { sinkWorker(); });
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+
+    logQueueOccupancy("Final pipeline queue occupancy");
+    return m_stats;
+}
+
+void PipelineExecutor::readWorker() {
+
+    if (m_trace) {
+        m_trace->setThreadName("read");
+    }
+
+    for (size_t sequence = 0; !m_stop.load(std::memory_order_acquire); ++sequence) {
+
+        PipelineBatch batch;
+        batch.sequence = sequence;
+
+        {
+            ScopedStageTimer readTimer(m_stageStats, PipelineStage::READ);
+            ScopedTraceSpan readSpan(m_trace, pipelineStageName(PipelineStage::READ), sequence);
+            if (!m_frameSource.readBatch(batch.frames, m_logger)) {
+                readTimer.cancel();
+                readSpan.cancel();
+                m_totalBatches.store(sequence, std::memory_order_release);
+                return;
+            }
+            readTimer.setFrames(countSourceFrames(batch.frames));
+            readSpan.setFrames(firstFrameId(batch.frames), countSourceFrames(batch.frames));
+        }
+
+        for (FrameMetadata& metadata : batch.frames.metas) {
+            metadata.inputWidth = m_config.inputWidth;
+            metadata.inputHeight = m_config.inputHeight;
+            metadata.resultsDir = m_config.resultsDir;
+        }
+
+        if (!m_toPreProcess.push(batch, m_stop)) {
+            return;
+        }
+    }
+}
+
+void PipelineExecutor::preProcessWorker(size_t workerId) {
+
+    if (m_trace) {
+        m_trace->setThreadName("preprocess-" + std::to_string(workerId));
+    }
+
+    PipelineBatch batch;
+
+    for (size_t sequence = workerId; ; sequence += m_config.preProcessThreads) {
+
+        if (!m_toPreProcess.pop(sequence, batch, m_stop, m_totalBatches)) {
+            return;
+        }
+
+        PipelineTensorContext* context = m_tensorRing->acquire(sequence);
+        if (!context) {
+            return;
+        }
+
+        {
+            ScopedStageTimer preProcessTimer(m_stageStats, PipelineStage::PREPROCESS, countSourceFrames(batch.frames));
+            ScopedTraceSpan preProcessSpan(
+                m_trace, pipelineStageName(PipelineStage::PREPROCESS), sequence,
+                firstFrameId(batch.frames), countSourceFrames(batch.frames)
+            );
+            m_preProcessor.process(batch.frames, context->preProcessing.bufferViews.get());
+        }
+        m_frameSource.releaseBatch(batch.frames);
+
+        if (!m_toInference.push(batch, m_stop)) {
+            return;
+        }
+    }
+}
+
+void PipelineExecutor::inferenceWorker() {
+
+    CudaStream streamHolder;
+    if (m_config.inferenceDevice == PreferredProcessingDevice::PREFER_GPU) {
+        CUDA_THROW(cudaSetDevice(m_cudaDevice));
+        streamHolder.createStream();
+    }
+    cudaStream_t stream = streamHolder.get();
+
+    if (m_trace) {
+        m_trace->setThreadName("inference");
+    }
+
+    InferenceStageTimer inferenceTimer(m_stageStats);
+    PipelineBatch batch;
+
+    for (size_t sequence = 0; ; ++sequence) {
+
+        if (!m_toInference.pop(sequence, batch, m_stop, m_totalBatches)) {
+            return;
+        }
+
+        PipelineTensorContext& context = m_tensorRing->at(sequence);
+        {
+            ScopedTraceSpan inferenceSpan(
+                m_trace, pipelineStageName(PipelineStage::INFERENCE), sequence,
+                firstFrameId(batch.frames), countSourceFrames(batch.frames)
+            );
+
+            // Backends bind device addresses, so point them at this batch's slot.
+            if (m_tensorRing->size() > 1) {
+                m_inferBackend.bindTensorViewMaps(context.inference.bindableTensorViews);
+            }
+
+            inferenceTimer.mark(0, stream);
+            MemoryManager::transferTensors(context.preProcessingToInference, m_inputKeys, stream);
+            inferenceTimer.mark(1, stream);
+            m_inferBackend.runInference(
+                context.inference.inputBufferViews.get(),
+                context.inference.outputBufferViews.get(),
+                stream
+            );
+            inferenceTimer.mark(2, stream);
+            MemoryManager::transferTensors(context.inferenceToPostProcessing, m_outputKeys, stream);
+            inferenceTimer.mark(3, stream);
+
+            if (stream) {
+                CUDA_THROW(cudaStreamSynchronize(stream));
+            }
+        }
+        inferenceTimer.record(countSourceFrames(batch.frames));
+
+        if (m_captureWriter) {
+            m_captureWriter->append(context.postProcessing.bufferViews.get(), batch.frames.metas);
+        }
+
+        if (!m_toPostProcess.push(batch, m_stop)) {
+            return;
+        }
+    }
+}
+
+void PipelineExecutor::postProcessWorker(size_t workerId) {
+
+    if (m_trace) {
+        m_trace->setThreadName("postprocess-" + std::to_string(workerId));
+    }
+
+    PipelineBatch batch;
+
+    for (size_t sequence = workerId; ; sequence += m_config.postProcessThreads) {
+
+        if (!m_toPostProcess.pop(sequence, batch, m_stop, m_totalBatches)) {
+            return;
+        }
+
+        batch.outputs.clear();
+        batch.outputs.resize(batch.frames.metas.size());
+        for (size_t batchIdx = 0; batchIdx < batch.outputs.size(); ++batchIdx) {
+            batch.outputs[batchIdx].metadata = batch.frames.metas[batchIdx];
+        }
+
+        // Device work for this batch was synchronized by the inference stage.
+        {
+            ScopedStageTimer postProcessTimer(m_stageStats, PipelineStage::POSTPROCESS, countSourceFrames(batch.frames));
+            ScopedTraceSpan postProcessSpan(
+                m_trace, pipelineStageName(PipelineStage::POSTPROCESS), sequence,
+                firstFrameId(batch.frames), countSourceFrames(batch.frames)
+            );
+            m_postProcessor.process(
+                m_tensorRing->at(sequence).postProcessing.bufferViews.get(),
+                batch.outputs,
+                m_logger,
+                nullptr
+            );
+        }
+        m_tensorRing->release(sequence);
+
+        if (!m_toSink.push(batch, m_stop)) {
+            return;
+        }
+    }
+}
+
+void PipelineExecutor::sinkWorker() {
+
+    if (m_trace) {
+        m_trace->setThreadName("sink");
+    }
+
+    PipelineBatch batch;
+
+    for (size_t sequence = 0; ; ++sequence) {
+
+        if (!m_toSink.pop(sequence, batch, m_stop, m_totalBatches)) {
+            return;
+        }
+
+        const size_t sourceFrames = countSourceFrames(batch.frames);
+        {
+            ScopedStageTimer sinkTimer(m_stageStats, PipelineStage::SINK, sourceFrames);
+            ScopedTraceSpan sinkSpan(
+                m_trace, pipelineStageName(PipelineStage::SINK), sequence,
+                firstFrameId(batch.frames), sourceFrames
+            );
+            m_resultSink.consumeBatch(batch.outputs, m_logger);
+        }
+
+        m_stats.totalSourceFrames += sourceFrames;
+        ++m_stats.totalBatches;
+        m_batchesCompleted.increment();
+
+        sampleQueueOccupancy();
+        if (m_config.queueReportInterval > 0 &&
+            m_stats.totalBatches % m_config.queueReportInterval == 0) {
+            logQueueOccupancy("Pipeline queue occupancy");
+        }
+
+        if (m_stageStats && m_config.statsReportInterval > 0 &&
+            m_stats.totalBatches % m_config.statsReportInterval == 0) {
+            m_stageStats->logIntervalReport(m_logger);
+        }
+    }
+}
+
+void PipelineExecutor::sampleQueueOccupancy() {
+    const StageLink* links[] = {&m_toPreProcess, &m_toInference, &m_toPostProcess, &m_toSink};
+
+    for (size_t i = 0; i < m_occupancy.size(); ++i) {
+        const size_t occupancy = links[i]->occupancy();
+        QueueOccupancy& stats = m_occupancy[i];
+        ++stats.samples;
+        stats.sum += occupancy;
+        stats.max = std::max(stats.max, occupancy);
+        stats.depth->set(static_cast<int64_t>(occupancy));
+    }
+}
+
+void PipelineExecutor::logQueueOccupancy(const char* label) {
+    const StageLink* links[] = {&m_toPreProcess, &m_toInference, &m_toPostProcess, &m_toSink};
+
+    std::ostringstream report;
+    report << label << " after " << m_stats.totalBatches << " batches (avg/max/capacity):";
+
+    for (size_t i = 0; i < m_occupancy.size(); ++i) {
+        const QueueOccupancy& stats = m_occupancy[i];
+        const double average = stats.samples > 0
+            ? static_cast<double>(stats.sum) / static_cast<double>(stats.samples)
+            : 0.0;
+
+        report << ' ' << links[i]->name() << ' '
+               << average << '/' << stats.max << '/' << links[i]->capacity();
+    }
+
+    m_logger.logConcatMessage(LoggingSeverityType::INFO, report.str(), '\n');
+}
+
+void PipelineExecutor::fail(std::exception_ptr error) {
+    {
+        std::lock_guard<std::mutex> lock(m_errorMutex);
+        if (!m_error) {
+            m_error = error;
+        }
+    }
+    m_stop.store(true, std::memory_order_release);
+    m_tensorRing->cancel();
+}
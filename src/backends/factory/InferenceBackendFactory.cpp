@@ -1,5 +1,8 @@
 #include "backends/factory/InferenceBackendFactory.hpp"
 #include "backends/interface/InferenceBackend.hpp"
+#include "backends/modes/MockInferenceBackend.hpp"
+#include "backends/modes/ReplayInferenceBackend.hpp"
+#include "backends/modes/YoloSegOcvCpuBackend.hpp"
 #include "backends/modes/YoloSegTRTBackend.hpp"
 
 
@@ -9,5 +12,17 @@ std::unique_ptr<InferenceBackend> createInferenceBackend(InferenceBackendConfig
         return std::make_unique<YoloSegTRTBackend>(config, baseLogger);
     }
 
+    if (config.inferBackend == BackendType::YoloSegOcvCpu) {
+        return std::make_unique<YoloSegOcvCpuBackend>(config, baseLogger);
+    }
+
+    if (config.inferBackend == BackendType::Replay) {
+        return std::make_unique<ReplayInferenceBackend>(config, baseLogger);
+    }
+
+    if (config.inferBackend == BackendType::Mock) {
+        return std::make_unique<MockInferenceBackend>(config, baseLogger);
+    }
+
     return nullptr;
 }
\ No newline at end of file
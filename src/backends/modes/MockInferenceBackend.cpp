@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "backends/modes/MockInferenceBackend.hpp"
+#include "post_process/cpu/YoloSegCpuPostProcessorSimple.hpp"
+
+namespace {
+
+constexpr size_t NUM_MOCK_CLASSES = 80;
+
+/**
+ * @brief Stateless 64-bit mix used to derive per-detection values from a seed.
+ */
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+float unitFloat(uint64_t hash) {
+    return static_cast<float>(hash >> 40) / static_cast<float>(1ULL << 24);
+}
+
+} // namespace
+
+
+MockInferenceBackend::MockInferenceBackend(
+    const InferenceBackendConfig& config,
+    BaseLogger& baseLogger
+):
+    m_logger(baseLogger),
+    m_fixedLatency(config.mockFixedLatencyUs),
+    m_perItemLatency(config.mockPerItemLatencyUs),
+    m_jitterUs(static_cast<int64_t>(config.mockLatencyJitterUs)),
+    m_detectionsPerFrame(config.mockDetectionsPerFrame),
+    m_seed(config.mockSeed),
+    m_jitterRng(config.mockSeed) {
+
+    m_logger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Mock inference latency: ", config.mockFixedLatencyUs, "us + ",
+        config.mockPerItemLatencyUs, "us/item +- ", config.mockLatencyJitterUs,
+        "us, ", m_detectionsPerFrame, " detection(s) per frame\n"
+    );
+}
+
+TensorSpecMap MockInferenceBackend::getTensorSpecs() {
+    return m_boundSpecs;
+}
+
+void MockInferenceBackend::bindTensorViewMap(const TensorViewMap& bufferViews) {
+
+    for (const auto& [name, tv] : bufferViews) {
+        m_boundSpecs[name] = TensorSpec{tv.shape, tv.type, tv.mode};
+
+        // Synthetic boxes live in network input pixel space; 8-bit NHWC inputs end in the channels.
+        if (tv.mode == IOMode::Input && tv.shape.rank() == 4) {
+            const bool nhwc = tv.shape[1] != 3 && tv.shape[3] == 3;
+            m_inputHeight = nhwc ? tv.shape[1] : tv.shape[2];
+            m_inputWidth = nhwc ? tv.shape[2] : tv.shape[3];
+        }
+    }
+}
+
+bool MockInferenceBackend::runInference(
+    const TensorViewMap& inputBufferViews,
+    TensorViewMap& outputBufferViews,
+    cudaStream_t stream
+) {
+    (void)inputBufferViews;
+    (void)stream;
+
+    if (!TensorViewsOnDevice(outputBufferViews, DeviceType::CPU)) {
+        throw std::runtime_error("All output buffer views must reference host memory for the mock backend.");
+    }
+
+    const std::string boxKey(YoloSegCpuPostProcessorSimpleSettings::BoxKey);
+    const auto boxes = outputBufferViews.find(boxKey);
+    if (boxes == outputBufferViews.end() || boxes->second.shape.rank() != 3) {
+        throw std::runtime_error("Mock backend requires a [B, N, 4] boxes output.");
+    }
+    const size_t batchSize = boxes->second.shape[0];
+
+    std::chrono::microseconds latency = m_fixedLatency + m_perItemLatency * static_cast<int64_t>(batchSize);
+    if (m_jitterUs > 0) {
+        std::uniform_int_distribution<int64_t> jitter(-m_jitterUs, m_jitterUs);
+        latency += std::chrono::microseconds(jitter(m_jitterRng));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::max(latency, std::chrono::microseconds(0));
+
+    writeDetections(outputBufferViews, batchSize);
+
+    std::this_thread::sleep_until(deadline);
+    return true;
+}
+
+void MockInferenceBackend::writeDetections(TensorViewMap& outputBufferViews, size_t batchSize) {
+
+    TensorView& boxView = outputBufferViews.at(std::string(YoloSegCpuPostProcessorSimpleSettings::BoxKey));
+    TensorView& maskView = outputBufferViews.at(std::string(YoloSegCpuPostProcessorSimpleSettings::MaskKey));
+    TensorView& labelView = outputBufferViews.at(std::string(YoloSegCpuPostProcessorSimpleSettings::LabelKey));
+    TensorView& scoreView = outputBufferViews.at(std::string(YoloSegCpuPostProcessorSimpleSettings::ScoreKey));
+
+    if (maskView.shape.rank() != 4) {
+        throw std::runtime_error("Mock backend requires a [B, N, H, W] masks output.");
+    }
+
+    float* boxData = boxView.ptr<float>();
+    float* maskData = maskView.ptr<float>();
+    float* labelData = labelView.ptr<float>();
+    float* scoreData = scoreView.ptr<float>();
+
+    const size_t nBoxes = boxView.shape[1];
+    const size_t maskH = maskView.shape[2];
+    const size_t maskW = maskView.shape[3];
+    const size_t inputH = m_inputHeight ? m_inputHeight : maskH;
+    const size_t inputW = m_inputWidth ? m_inputWidth : maskW;
+
+    const size_t numDetections = std::min(m_detectionsPerFrame, nBoxes);
+    const size_t gridCols = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(numDetections)))));
+    const size_t gridRows = std::max<size_t>(1, (numDetections + gridCols - 1) / gridCols);
+    const float cellW = static_cast<float>(inputW) / static_cast<float>(gridCols);
+    const float cellH = static_cast<float>(inputH) / static_cast<float>(gridRows);
+
+    for (size_t b = 0; b < batchSize; ++b, ++m_framesProduced) {
+
+        const uint64_t frameSeed = splitMix64(m_seed ^ splitMix64(m_framesProduced));
+
+        // Only objectness gates candidates, so unused slots just need a zero score.
+        std::fill_n(scoreData + idx3(b, 0, 0, nBoxes, 1), nBoxes, 0.f);
+
+        for (size_t i = 0; i < numDetections; ++i) {
+
+            const uint64_t h0 = splitMix64(frameSeed + 6 * i);
+            const uint64_t h1 = splitMix64(frameSeed + 6 * i + 1);
+            const uint64_t h2 = splitMix64(frameSeed + 6 * i + 2);
+            const uint64_t h3 = splitMix64(frameSeed + 6 * i + 3);
+            const uint64_t h4 = splitMix64(frameSeed + 6 * i + 4);
+            const uint64_t h5 = splitMix64(frameSeed + 6 * i + 5);
+
+            // One box per grid cell, 50-90% of the cell, so NMS keeps every detection.
+            const float cellX = static_cast<float>(i % gridCols) * cellW;
+            const float cellY = static_cast<float>(i / gridCols) * cellH;
+            const float boxW = cellW * (0.5f + 0.4f * unitFloat(h0));
+            const float boxH = cellH * (0.5f + 0.4f * unitFloat(h1));
+            const float x1 = cellX + (cellW - boxW) * unitFloat(h2);
+            const float y1 = cellY + (cellH - boxH) * unitFloat(h3);
+
+            float* box = boxData + idx3(b, i, 0, nBoxes, 4);
+            box[0] = x1;
+            box[1] = y1;
+            box[2] = x1 + boxW;
+            box[3] = y1 + boxH;
+
+            scoreData[idx3(b, i, 0, nBoxes, 1)] = 0.5f + 0.5f * unitFloat(h4);
+            labelData[idx3(b, i, 0, nBoxes, 1)] = static_cast<float>(h5 % NUM_MOCK_CLASSES);
+
+            // Filled rectangle mask over the box, in mask resolution.
+            float* mask = maskData + idx4(b, i, 0, 0, nBoxes, maskH, maskW);
+            std::fill_n(mask, maskH * maskW, 0.f);
+
+            const size_t mx1 = static_cast<size_t>(box[0] * maskW / inputW);
+            const size_t my1 = static_cast<size_t>(box[1] * maskH / inputH);
+            const size_t mx2 = std::min(maskW, static_cast<size_t>(std::ceil(box[2] * maskW / inputW)));
+            const size_t my2 = std::min(maskH, static_cast<size_t>(std::ceil(box[3] * maskH / inputH)));
+
+            for (size_t y = my1; y < my2; ++y) {
+                std::fill(mask + y * maskW + mx1, mask + y * maskW + mx2, 1.f);
+            }
+        }
+    }
+}
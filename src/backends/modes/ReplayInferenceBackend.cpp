@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "backends/modes/ReplayInferenceBackend.hpp"
+
+ReplayInferenceBackend::ReplayInferenceBackend(
+    const InferenceBackendConfig& config,
+    BaseLogger& baseLogger
+):
+    m_logger(baseLogger),
+    m_reader(config.modelFilePath),
+    m_loop(config.replayLoop) {
+
+    uint64_t numFrames = 0;
+    for (uint64_t record = 0; record < m_reader.numRecords(); ++record) {
+        if (!isPaddingRecord(record)) {
+            ++numFrames;
+        }
+    }
+
+    if (numFrames == 0) {
+        throw std::runtime_error("Replay capture contains no frame records: " + config.modelFilePath.string());
+    }
+
+    if (config.replayStartFrame != 0) {
+        seek(config.replayStartFrame);
+    }
+
+    m_logger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Replaying ", numFrames, " captured frame(s) from ",
+        config.modelFilePath.string(), m_loop ? " (looping)" : "", '\n'
+    );
+}
+
+TensorSpecMap ReplayInferenceBackend::getTensorSpecs() {
+
+    TensorSpecMap infoMap;
+
+    for (const capture::CaptureTensorEntry& entry : m_reader.tensors()) {
+        Shape shape;
+        shape.dims.assign(entry.dims, entry.dims + entry.rank);
+
+        infoMap.emplace(
+            entry.name,
+            TensorSpec {
+                shape,
+                static_cast<DataType>(entry.dtype),
+                IOMode::Output
+            }
+        );
+    }
+
+    return infoMap;
+}
+
+void ReplayInferenceBackend::bindTensorViewMap(const TensorViewMap& bufferViews) {
+
+    for (const auto& [name, tv] : bufferViews) {
+        if (tv.mode != IOMode::Output || tv.device != DeviceType::CPU) {
+            continue;
+        }
+
+        if (!tv.data) {
+            throw std::runtime_error("Memory not allocated for tensor: " + name);
+        }
+
+        const capture::CaptureTensorEntry* entry = m_reader.findTensor(name);
+        if (!entry) {
+            throw std::runtime_error("Output tensor not present in replay capture: " + name);
+        }
+
+        if (static_cast<DataType>(entry->dtype) != tv.type ||
+            tv.shape.rank() == 0 ||
+            tv.totalBytes != entry->itemBytes * tv.shape[0]) {
+            throw std::runtime_error("Output tensor layout differs from replay capture: " + name);
+        }
+
+        auto existing = std::find_if(m_outputs.begin(), m_outputs.end(), [&](const ReplayTensor& tensor) {
+            return tensor.entry == entry;
+        });
+
+        if (existing != m_outputs.end()) {
+            existing->view = tv;
+        } else {
+            m_outputs.push_back(ReplayTensor{tv, entry});
+        }
+    }
+}
+
+bool ReplayInferenceBackend::runInference(
+    const TensorViewMap& inputBufferViews,
+    TensorViewMap& outputBufferViews,
+    cudaStream_t stream
+) {
+    (void)inputBufferViews;
+    (void)stream;
+
+    if (!TensorViewsOnDevice(outputBufferViews, DeviceType::CPU)) {
+        throw std::runtime_error("All output buffer views must reference host memory for the replay backend.");
+    }
+
+    if (m_outputs.empty()) {
+        throw std::runtime_error("Replay backend has no bound host output tensors.");
+    }
+
+    const size_t batchSize = m_outputs.front().view.shape[0];
+
+    for (size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx) {
+
+        // Padding records hold the outputs of zero frames that filled a captured batch; real
+        // frames never consume them, whatever the batch size or source slicing of this run.
+        skipPaddingRecords();
+        if (m_nextRecord == m_reader.numRecords()) {
+            if (!m_loop) {
+                throw std::runtime_error("Replay capture exhausted.");
+            }
+            m_nextRecord = 0;
+            skipPaddingRecords();
+        }
+
+        for (const ReplayTensor& output : m_outputs) {
+            std::memcpy(
+                static_cast<std::byte*>(output.view.data) + batchIdx * output.entry->itemBytes,
+                m_reader.tensorData(m_nextRecord, *output.entry),
+                output.entry->itemBytes
+            );
+        }
+
+        ++m_nextRecord;
+    }
+
+    return true;
+}
+
+void ReplayInferenceBackend::seek(uint64_t frameId) {
+    try {
+        m_nextRecord = m_reader.findRecord(frameId);
+    } catch (const std::runtime_error& error) {
+        throw std::runtime_error(std::string("Cannot seek replay: ") + error.what());
+    }
+}
+
+bool ReplayInferenceBackend::isPaddingRecord(uint64_t record) const {
+    return (m_reader.recordHeader(record).flags & capture::RECORD_FLAG_PADDING) != 0;
+}
+
+void ReplayInferenceBackend::skipPaddingRecords() {
+    while (m_nextRecord < m_reader.numRecords() && isPaddingRecord(m_nextRecord)) {
+        ++m_nextRecord;
+    }
+}
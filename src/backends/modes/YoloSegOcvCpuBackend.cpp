@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <stdexcept>
+
+#include "backends/modes/YoloSegOcvCpuBackend.hpp"
+
+namespace {
+
+int DataType2CvDepth(DataType dtype) {
+    switch (dtype) {
+        case DataType::Float32:
+            return CV_32F;
+        case DataType::Float16:
+            return CV_16F;
+        case DataType::Int32:
+            return CV_32S;
+        case DataType::UInt8:
+            return CV_8U;
+        case DataType::Int8:
+            return CV_8S;
+        default:
+            throw std::runtime_error("Tensor data type is not supported by the OpenCV CPU backend");
+    }
+}
+
+bool isHostTensor(const TensorView& view) {
+    return view.device == DeviceType::CPU;
+}
+
+} // namespace
+
+
+YoloSegOcvCpuBackend::YoloSegOcvCpuBackend(
+    const InferenceBackendConfig& config,
+    BaseLogger& baseLogger
+):
+    m_logger(baseLogger) {
+
+    if (config.numCpuNetworkInstances == 0) {
+        throw std::runtime_error("OpenCV CPU backend requires at least one network instance.");
+    }
+
+    m_nets.reserve(config.numCpuNetworkInstances);
+    for (size_t instance = 0; instance < config.numCpuNetworkInstances; ++instance) {
+        cv::dnn::Net net = cv::dnn::readNetFromONNX(config.modelFilePath.string());
+
+        if (net.empty()) {
+            throw std::runtime_error("Failed to load ONNX model: " + config.modelFilePath.string());
+        }
+
+        net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+        net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+        m_nets.push_back(std::move(net));
+    }
+
+    // Instance 0 runs on the calling thread, so only the others need a worker.
+    if (m_nets.size() > 1) {
+        m_workers = std::make_unique<ThreadPool>(m_nets.size() - 1);
+    }
+
+    m_inputScratch.resize(m_nets.size());
+    m_outputBlobs.resize(m_nets.size());
+
+    m_logger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Loaded ", m_nets.size(), " OpenCV DNN CPU network instance(s) from ",
+        config.modelFilePath.string(), '\n'
+    );
+}
+
+TensorSpecMap YoloSegOcvCpuBackend::getTensorSpecs() {
+
+    TensorSpecMap infoMap;
+
+    for (const std::vector<BoundTensor>* tensors : {&m_inputs, &m_outputs}) {
+        for (const BoundTensor& tensor : *tensors) {
+            infoMap.emplace(
+                tensor.name,
+                TensorSpec {
+                    tensor.view.shape,
+                    tensor.view.type,
+                    tensor.view.mode
+                }
+            );
+        }
+    }
+
+    return infoMap;
+}
+
+void YoloSegOcvCpuBackend::bindTensorViewMap(const TensorViewMap& bufferViews) {
+
+    for (const auto& [name, tv] : bufferViews) {
+        if (!isHostTensor(tv)) {
+            continue;
+        }
+
+        if (!tv.data) {
+            throw std::runtime_error("Memory not allocated for tensor: " + name);
+        }
+
+        if (tv.shape.rank() == 0 || tv.shape[0] == 0) {
+            throw std::runtime_error("Tensor must have a leading batch dimension: " + name);
+        }
+
+        // cv::dnn would only widen the quantized values, so the network would see q instead of x.
+        if (tv.mode == IOMode::Input && tv.type == DataType::Int8) {
+            throw std::runtime_error(
+                "OpenCV CPU backend does not accept int8 input; use float32, float16 or uint8: " + name
+            );
+        }
+
+        std::vector<BoundTensor>& tensors = tv.mode == IOMode::Input ? m_inputs : m_outputs;
+        BoundTensor bound{name, tv, tv.numElements / tv.shape[0]};
+
+        auto existing = std::find_if(tensors.begin(), tensors.end(), [&](const BoundTensor& tensor) {
+            return tensor.name == name;
+        });
+
+        if (existing != tensors.end()) {
+            *existing = std::move(bound);
+        } else {
+            tensors.push_back(std::move(bound));
+        }
+    }
+
+    m_outputNames.clear();
+    for (const BoundTensor& output : m_outputs) {
+        m_outputNames.push_back(output.name);
+    }
+}
+
+bool YoloSegOcvCpuBackend::runInference(
+    const TensorViewMap& inputBufferViews,
+    TensorViewMap& outputBufferViews,
+    cudaStream_t stream
+) {
+    (void)stream;
+
+    if (!TensorViewsOnDevice(inputBufferViews, DeviceType::CPU)) {
+        throw std::runtime_error("All input buffer views must reference host memory for the OpenCV CPU backend.");
+    }
+
+    if (!TensorViewsOnDevice(outputBufferViews, DeviceType::CPU)) {
+        throw std::runtime_error("All output buffer views must reference host memory for the OpenCV CPU backend.");
+    }
+
+    if (m_inputs.empty() || m_outputs.empty()) {
+        throw std::runtime_error("OpenCV CPU backend has no bound host input/output tensors.");
+    }
+
+    const size_t batchSize = m_inputs.front().view.shape[0];
+    const size_t numWorkers = std::min(m_nets.size(), batchSize);
+
+    std::vector<std::future<void>> pending;
+    pending.reserve(numWorkers > 0 ? numWorkers - 1 : 0);
+
+    for (size_t instance = 1; instance < numWorkers; ++instance) {
+        pending.push_back(m_workers->submit([this, instance, batchSize]() {
+            runItems(instance, batchSize);
+        }));
+    }
+
+    std::exception_ptr error;
+    try {
+        runItems(0, batchSize);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // Workers write into the bound tensors, so wait for all before rethrowing a failure.
+    for (std::future<void>& task : pending) {
+        task.wait();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    for (std::future<void>& task : pending) {
+        task.get();
+    }
+
+    return true;
+}
+
+void YoloSegOcvCpuBackend::runItems(size_t instance, size_t batchSize) {
+    const size_t stride = std::min(m_nets.size(), batchSize);
+
+    for (size_t batchIdx = instance; batchIdx < batchSize; batchIdx += stride) {
+        runItem(instance, batchIdx);
+    }
+}
+
+void YoloSegOcvCpuBackend::runItem(size_t instance, size_t batchIdx) {
+
+    cv::dnn::Net& net = m_nets[instance];
+    std::vector<cv::Mat>& scratch = m_inputScratch[instance];
+    scratch.resize(m_inputs.size());
+
+    for (size_t inputIdx = 0; inputIdx < m_inputs.size(); ++inputIdx) {
+        const BoundTensor& input = m_inputs[inputIdx];
+
+        std::vector<int> itemShape(input.view.shape.dims.begin(), input.view.shape.dims.end());
+        itemShape[0] = 1;
+
+        const int depth = DataType2CvDepth(input.view.type);
+        const size_t itemBytes = input.itemElements * getSize(input.view.type);
+        cv::Mat itemBlob(
+            itemShape,
+            depth,
+            static_cast<std::byte*>(input.view.data) + batchIdx * itemBytes
+        );
+
+        // cv::dnn consumes FP32 and UInt8 blobs directly; anything else is widened once.
+        if (depth == CV_32F || depth == CV_8U) {
+            net.setInput(itemBlob, input.name);
+        } else {
+            itemBlob.convertTo(scratch[inputIdx], CV_32F);
+            net.setInput(scratch[inputIdx], input.name);
+        }
+    }
+
+    std::vector<cv::Mat>& outputBlobs = m_outputBlobs[instance];
+    net.forward(outputBlobs, m_outputNames);
+
+    for (size_t outputIdx = 0; outputIdx < m_outputs.size(); ++outputIdx) {
+        const BoundTensor& output = m_outputs[outputIdx];
+        const cv::Mat& blob = outputBlobs[outputIdx];
+
+        if (blob.total() != output.itemElements) {
+            throw std::runtime_error("OpenCV DNN output size does not match bound tensor: " + output.name);
+        }
+
+        const int depth = DataType2CvDepth(output.view.type);
+        const size_t itemBytes = output.itemElements * getSize(output.view.type);
+        cv::Mat target(
+            1,
+            static_cast<int>(output.itemElements),
+            depth,
+            static_cast<std::byte*>(output.view.data) + batchIdx * itemBytes
+        );
+
+        const cv::Mat flat = blob.reshape(1, 1);
+        if (flat.depth() == depth) {
+            flat.copyTo(target);
+        } else {
+            flat.convertTo(target, depth);
+        }
+    }
+}
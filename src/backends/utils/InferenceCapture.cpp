@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "backends/utils/InferenceCapture.hpp"
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+size_t itemBytesOf(const TensorView& view) {
+    if (view.shape.rank() == 0 || view.shape[0] == 0) {
+        throw std::runtime_error("Captured tensors must have a leading batch dimension");
+    }
+    return view.totalBytes / view.shape[0];
+}
+
+} // namespace
+
+
+InferenceCaptureWriter::InferenceCaptureWriter(const fs::path& path, const TensorViewMap& outputViews):
+    m_path(path) {
+
+    std::vector<std::string> names = TensorKeys(outputViews);
+    std::sort(names.begin(), names.end());
+
+    size_t recordOffset = sizeof(capture::CaptureRecordHeader);
+
+    for (const std::string& name : names) {
+        const TensorView& view = outputViews.at(name);
+
+        if (view.device != DeviceType::CPU) {
+            throw std::runtime_error("Inference capture requires host output tensors: " + name);
+        }
+        if (name.size() >= capture::MAX_TENSOR_NAME || view.shape.rank() > capture::MAX_TENSOR_RANK) {
+            throw std::runtime_error("Tensor name or rank exceeds capture format limits: " + name);
+        }
+
+        capture::CaptureTensorEntry entry{};
+        std::memcpy(entry.name, name.data(), name.size());
+        entry.dtype = static_cast<uint32_t>(view.type);
+        entry.rank = static_cast<uint32_t>(view.shape.rank());
+        for (size_t dim = 0; dim < view.shape.rank(); ++dim) {
+            entry.dims[dim] = dim == 0 ? 1 : view.shape[dim];
+        }
+        entry.itemBytes = itemBytesOf(view);
+        entry.recordOffset = alignUp(recordOffset, capture::RECORD_ALIGNMENT);
+
+        recordOffset = entry.recordOffset + entry.itemBytes;
+        m_entries.push_back(entry);
+    }
+
+    std::memcpy(m_header.magic, capture::FILE_MAGIC, sizeof(m_header.magic));
+    m_header.version = capture::FILE_VERSION;
+    m_header.numTensors = static_cast<uint32_t>(m_entries.size());
+    m_header.numRecords = 0;
+    m_header.recordBytes = alignUp(recordOffset, capture::RECORD_ALIGNMENT);
+    m_header.dataOffset = alignUp(
+        sizeof(capture::CaptureFileHeader) + m_entries.size() * sizeof(capture::CaptureTensorEntry),
+        capture::DATA_ALIGNMENT
+    );
+
+    if (m_path.has_parent_path()) {
+        fs::create_directories(m_path.parent_path());
+    }
+
+    m_file.open(m_path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Failed to create capture file: " + m_path.string());
+    }
+
+    m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+    m_file.write(
+        reinterpret_cast<const char*>(m_entries.data()),
+        static_cast<std::streamsize>(m_entries.size() * sizeof(capture::CaptureTensorEntry))
+    );
+
+    const std::vector<char> padding(m_header.dataOffset - static_cast<size_t>(m_file.tellp()), 0);
+    m_file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+    m_record.assign(m_header.recordBytes, std::byte{0});
+}
+
+InferenceCaptureWriter::~InferenceCaptureWriter() {
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+void InferenceCaptureWriter::append(const TensorViewMap& outputViews, const std::vector<FrameMetadata>& metas) {
+
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Capture file is closed: " + m_path.string());
+    }
+
+    for (size_t batchIdx = 0; batchIdx < metas.size(); ++batchIdx) {
+
+        capture::CaptureRecordHeader recordHeader{
+            metas[batchIdx].frameId,
+            metas[batchIdx].isPadding ? capture::RECORD_FLAG_PADDING : 0
+        };
+        std::memcpy(m_record.data(), &recordHeader, sizeof(recordHeader));
+
+        for (const capture::CaptureTensorEntry& entry : m_entries) {
+            const TensorView& view = outputViews.at(entry.name);
+
+            if ((batchIdx + 1) * entry.itemBytes > view.totalBytes) {
+                throw std::runtime_error("Batch exceeds captured tensor size: " + std::string(entry.name));
+            }
+
+            std::memcpy(
+                m_record.data() + entry.recordOffset,
+                static_cast<const std::byte*>(view.data) + batchIdx * entry.itemBytes,
+                entry.itemBytes
+            );
+        }
+
+        m_file.write(reinterpret_cast<const char*>(m_record.data()), static_cast<std::streamsize>(m_record.size()));
+        ++m_header.numRecords;
+    }
+
+    if (!m_file) {
+        throw std::runtime_error("Failed to write capture file: " + m_path.string());
+    }
+}
+
+void InferenceCaptureWriter::close() {
+
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+    m_file.close();
+}
+
+
+InferenceCaptureReader::InferenceCaptureReader(const fs::path& path):
+    m_path(path) {
+
+    m_fd = ::open(m_path.c_str(), O_RDONLY);
+    if (m_fd < 0) {
+        throw std::runtime_error("Failed to open capture file: " + m_path.string());
+    }
+
+    struct stat fileStat{};
+    if (::fstat(m_fd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) < sizeof(capture::CaptureFileHeader)) {
+        ::close(m_fd);
+        throw std::runtime_error("Capture file is truncated: " + m_path.string());
+    }
+    m_mappingBytes = static_cast<size_t>(fileStat.st_size);
+
+    void* mapping = ::mmap(nullptr, m_mappingBytes, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(m_fd);
+        throw std::runtime_error("Failed to map capture file: " + m_path.string());
+    }
+    m_mapping = static_cast<const std::byte*>(mapping);
+    ::madvise(mapping, m_mappingBytes, MADV_SEQUENTIAL);
+
+    try {
+        indexRecords();
+    } catch (...) {
+        ::munmap(mapping, m_mappingBytes);
+        ::close(m_fd);
+        throw;
+    }
+}
+
+void InferenceCaptureReader::indexRecords() {
+
+    std::memcpy(&m_header, m_mapping, sizeof(m_header));
+
+    if (std::memcmp(m_header.magic, capture::FILE_MAGIC, sizeof(m_header.magic)) != 0 ||
+        m_header.version != capture::FILE_VERSION) {
+        throw std::runtime_error("Unsupported capture file format: " + m_path.string());
+    }
+
+    const size_t tableEnd = sizeof(capture::CaptureFileHeader) +
+        m_header.numTensors * sizeof(capture::CaptureTensorEntry);
+    if (tableEnd > m_mappingBytes || m_header.dataOffset > m_mappingBytes || m_header.recordBytes == 0) {
+        throw std::runtime_error("Capture file header is corrupt: " + m_path.string());
+    }
+
+    m_entries.resize(m_header.numTensors);
+    std::memcpy(
+        m_entries.data(),
+        m_mapping + sizeof(capture::CaptureFileHeader),
+        m_entries.size() * sizeof(capture::CaptureTensorEntry)
+    );
+
+    // An interrupted capture never patched numRecords; trust the complete records on disk.
+    const uint64_t recordsOnDisk = (m_mappingBytes - m_header.dataOffset) / m_header.recordBytes;
+    if (m_header.numRecords == 0 || m_header.numRecords > recordsOnDisk) {
+        m_header.numRecords = recordsOnDisk;
+    }
+
+    m_recordByFrameId.reserve(m_header.numRecords);
+    for (uint64_t record = 0; record < m_header.numRecords; ++record) {
+        const capture::CaptureRecordHeader& header = recordHeader(record);
+        if (!(header.flags & capture::RECORD_FLAG_PADDING)) {
+            m_recordByFrameId.emplace(header.frameId, record);
+        }
+    }
+}
+
+InferenceCaptureReader::~InferenceCaptureReader() {
+    if (m_mapping) {
+        ::munmap(const_cast<std::byte*>(m_mapping), m_mappingBytes);
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+const capture::CaptureTensorEntry* InferenceCaptureReader::findTensor(const std::string& name) const {
+    for (const capture::CaptureTensorEntry& entry : m_entries) {
+        if (name == entry.name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t InferenceCaptureReader::findRecord(uint64_t frameId) const {
+    const auto it = m_recordByFrameId.find(frameId);
+    if (it == m_recordByFrameId.end()) {
+        throw std::runtime_error("Frame id not present in capture: " + std::to_string(frameId));
+    }
+    return it->second;
+}
+
+const capture::CaptureRecordHeader& InferenceCaptureReader::recordHeader(uint64_t record) const {
+    return *reinterpret_cast<const capture::CaptureRecordHeader*>(recordBase(record));
+}
+
+const std::byte* InferenceCaptureReader::tensorData(uint64_t record, const capture::CaptureTensorEntry& tensor) const {
+    return recordBase(record) + tensor.recordOffset;
+}
+
+const std::byte* InferenceCaptureReader::recordBase(uint64_t record) const {
+    if (record >= m_header.numRecords) {
+        throw std::runtime_error("Capture record index out of range");
+    }
+    return m_mapping + m_header.dataOffset + record * m_header.recordBytes;
+}
@@ -0,0 +1,50 @@
+#include <stdexcept>
+
+#include "core/ThreadPool.hpp"
+
+
+ThreadPool::ThreadPool(size_t numThreads) {
+
+    if (numThreads == 0) {
+        throw std::runtime_error("ThreadPool requires at least one thread");
+    }
+
+    m_workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeup.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeup.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+
+            if (m_tasks.empty()) {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
@@ -37,6 +37,20 @@ YAML::Node section(const YAML::Node& root, const std::string& name) {
     return node;
 }
 
+YAML::Node optionalSection(const YAML::Node& root, const std::string& name) {
+    YAML::Node node = root[name];
+
+    if (!node || !node.IsDefined()) {
+        return YAML::Node(YAML::NodeType::Map);
+    }
+
+    if (!node.IsMap()) {
+        throw std::runtime_error("YAML section must be a map: " + name);
+    }
+
+    return node;
+}
+
 template <typename T>
 T required(const YAML::Node& node, const std::string& path, const std::string& key) {
     YAML::Node value = node[key];
@@ -89,11 +103,34 @@ FrameSourceType parseFrameSourceType(const std::string& raw) {
 
     if (v == "folder" || v == "dir" || v == "directory") return FrameSourceType::FOLDER;
     if (v == "video") return FrameSourceType::VIDEO;
+    if (v == "manifest") return FrameSourceType::MANIFEST;
+    if (v == "raw_packed" || v == "rawpacked") return FrameSourceType::RAW_PACKED;
+    if (v == "synthetic") return FrameSourceType::SYNTHETIC;
+    if (v == "shared_memory" || v == "shm") return FrameSourceType::SHARED_MEMORY;
     if (v == "unset") return FrameSourceType::UNSET;
 
     throw std::runtime_error("Unsupported FrameSourceType string: " + raw);
 }
 
+SyntheticPattern parseSyntheticPattern(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "solid") return SyntheticPattern::SOLID;
+    if (v == "shapes") return SyntheticPattern::SHAPES;
+    if (v == "noise") return SyntheticPattern::NOISE;
+
+    throw std::runtime_error("Unsupported SyntheticPattern string: " + raw);
+}
+
+FileReadMode parseFileReadMode(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "read") return FileReadMode::READ;
+    if (v == "mmap") return FileReadMode::MMAP;
+
+    throw std::runtime_error("Unsupported FileReadMode string: " + raw);
+}
+
 ChannelOrderType parseChannelOrder(const std::string& raw) {
     const std::string v = normalize(raw);
 
@@ -103,6 +140,24 @@ ChannelOrderType parseChannelOrder(const std::string& raw) {
     throw std::runtime_error("Unsupported ChannelOrderType string: " + raw);
 }
 
+ResizeModeType parseResizeMode(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "stretch") return ResizeModeType::STRETCH;
+    if (v == "letterbox") return ResizeModeType::LETTERBOX;
+
+    throw std::runtime_error("Unsupported ResizeModeType string: " + raw);
+}
+
+TensorLayoutType parseTensorLayout(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "nchw") return TensorLayoutType::NCHW;
+    if (v == "nhwc") return TensorLayoutType::NHWC;
+
+    throw std::runtime_error("Unsupported TensorLayoutType string: " + raw);
+}
+
 PreferredProcessingDevice parsePreferredDevice(const std::string& raw) {
     const std::string v = normalize(raw);
 
@@ -116,6 +171,9 @@ BackendType parseBackendType(const std::string& raw) {
     const std::string v = normalize(raw);
 
     if (v == "yolosegtrt" || v == "yolo_seg_trt" || v == "trt") return BackendType::YoloSegTRT;
+    if (v == "yolosegocvcpu" || v == "yolo_seg_ocv_cpu" || v == "ocv_cpu") return BackendType::YoloSegOcvCpu;
+    if (v == "replay") return BackendType::Replay;
+    if (v == "mock") return BackendType::Mock;
     if (v == "unset") return BackendType::UNSET;
 
     throw std::runtime_error("Unsupported BackendType string: " + raw);
@@ -151,6 +209,15 @@ OutputType parseOutputType(const std::string& raw) {
     throw std::runtime_error("Unsupported OutputType string: " + raw);
 }
 
+ExecutionMode parseExecutionMode(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "serial" || v == "sequential") return ExecutionMode::SERIAL;
+    if (v == "pipelined" || v == "pipeline") return ExecutionMode::PIPELINED;
+
+    throw std::runtime_error("Unsupported ExecutionMode string: " + raw);
+}
+
 LoggingSeverityType parseLoggingSeverity(const std::string& raw) {
     const std::string v = normalize(raw);
 
@@ -163,6 +230,15 @@ LoggingSeverityType parseLoggingSeverity(const std::string& raw) {
     throw std::runtime_error("Unsupported LoggingSeverityType string: " + raw);
 }
 
+LoggingMode parseLoggingMode(const std::string& raw) {
+    const std::string v = normalize(raw);
+
+    if (v == "sync" || v == "synchronous") return LoggingMode::SYNC;
+    if (v == "async" || v == "asynchronous") return LoggingMode::ASYNC;
+
+    throw std::runtime_error("Unsupported LoggingMode string: " + raw);
+}
+
 TensorGroup parseTensorGroup(const std::string& raw) {
     const std::string v = normalize(raw);
 
@@ -294,6 +370,8 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
     const YAML::Node memory = section(root, "memory");
     const YAML::Node postprocess = section(root, "postprocess");
     const YAML::Node resultSink = section(root, "result_sink");
+    const YAML::Node execution = optionalSection(root, "execution");
+    const YAML::Node instrumentation = optionalSection(root, "instrumentation");
 
     settings.logFilePath = optional<std::string>(
         logging,
@@ -305,15 +383,28 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
         optional<std::string>(logging, "loggingSeverity", "info")
     );
 
+    settings.loggingMode = parseLoggingMode(
+        optional<std::string>(logging, "loggingMode", "sync")
+    );
+
+    settings.loggingAsyncQueueCapacity = optional<size_t>(
+        logging,
+        "asyncQueueCapacity",
+        StaticSettings::DEFAULT_LOG_ASYNC_QUEUE_CAPACITY
+    );
+
     settings.frameSourceType = parseFrameSourceType(
         required<std::string>(frameSource, "frame_source", "frameSourceType")
     );
 
-    settings.frameSourcePath = required<std::string>(
-        frameSource,
-        "frame_source",
-        "frameSourcePath"
-    );
+    // Synthetic sources generate frames and read nothing.
+    settings.frameSourcePath = settings.frameSourceType == FrameSourceType::SYNTHETIC
+        ? optional<std::string>(frameSource, "frameSourcePath", "")
+        : required<std::string>(
+            frameSource,
+            "frame_source",
+            "frameSourcePath"
+        );
 
     settings.origImgHeight = required<size_t>(
         frameSource,
@@ -333,6 +424,29 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
         "batchSize"
     );
 
+    settings.decodeThreads = optional<size_t>(frameSource, "decodeThreads", 0);
+    settings.readAheadFrames = optional<size_t>(frameSource, "readAheadFrames", 0);
+    settings.reducedDecode = optional<bool>(frameSource, "reducedDecode", false);
+    settings.fileReadMode = parseFileReadMode(
+        optional<std::string>(frameSource, "fileReadMode", "read")
+    );
+    settings.prefetchFiles = optional<size_t>(frameSource, "prefetchFiles", 0);
+    settings.framePoolSize = optional<size_t>(frameSource, "framePoolSize", 0);
+    settings.startOffset = optional<size_t>(frameSource, "startOffset", 0);
+    settings.endOffset = optional<size_t>(frameSource, "endOffset", 0);
+    settings.syntheticPattern = parseSyntheticPattern(
+        optional<std::string>(frameSource, "syntheticPattern", "shapes")
+    );
+    settings.syntheticFrameCount = optional<size_t>(frameSource, "syntheticFrameCount", 0);
+    settings.syntheticFps = optional<double>(frameSource, "syntheticFps", 0.0);
+    settings.sharedMemoryTimeoutMs = optional<size_t>(frameSource, "sharedMemoryTimeoutMs", 0);
+    settings.videoFrameStride = optional<size_t>(frameSource, "videoFrameStride", 1);
+    settings.videoTargetFps = optional<double>(frameSource, "videoTargetFps", 0.0);
+    settings.videoStartMs = optional<size_t>(frameSource, "videoStartMs", 0);
+    settings.videoEndMs = optional<size_t>(frameSource, "videoEndMs", 0);
+    settings.videoDecodeSegments = optional<size_t>(frameSource, "videoDecodeSegments", 0);
+    settings.videoSegmentFrames = optional<size_t>(frameSource, "videoSegmentFrames", 128);
+
     settings.imgChannelOrdering = parseChannelOrder(
         required<std::string>(preprocess, "preprocess", "imgChannelOrdering")
     );
@@ -352,6 +466,9 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
     settings.preprocessedDataType = parseDataType(
         required<std::string>(preprocess, "preprocess", "preprocessedDataType")
     );
+    settings.imgTensorLayout = parseTensorLayout(
+        optional<std::string>(preprocess, "imgTensorLayout", "nchw")
+    );
 
     settings.imgPreProcessScalingFactor = optional<float>(
         preprocess,
@@ -365,6 +482,22 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
         0.0f
     );
 
+    settings.imgPreProcessChannelMeans = optional<std::vector<float>>(
+        preprocess,
+        "imgPreProcessingChannelMeans",
+        {}
+    );
+
+    settings.imgQuantizationScale = optional<float>(preprocess, "imgQuantizationScale", 0.0f);
+    settings.imgQuantizationZeroPoint = optional<int>(preprocess, "imgQuantizationZeroPoint", 0);
+
+    settings.imgResizeMode = parseResizeMode(
+        optional<std::string>(preprocess, "imgResizeMode", "stretch")
+    );
+    settings.imgLetterboxPadValue = optional<float>(preprocess, "imgLetterboxPadValue", 114.0f);
+
+    settings.preProcessImageThreads = optional<size_t>(preprocess, "preProcessImageThreads", 0);
+
     settings.preferredDevicePreProc = parsePreferredDevice(
         optional<std::string>(preprocess, "preferredDevicePreProc", "prefer_cpu")
     );
@@ -398,6 +531,36 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
         "serializedModelPath"
     );
 
+    settings.numCpuNetworkInstances = optional<size_t>(
+        backend,
+        "numCpuNetworkInstances",
+        1
+    );
+
+    settings.captureOutputPath = optional<std::string>(
+        backend,
+        "captureOutputPath",
+        ""
+    );
+
+    settings.replayLoop = optional<bool>(
+        backend,
+        "replayLoop",
+        true
+    );
+
+    settings.replayStartFrame = optional<uint64_t>(
+        backend,
+        "replayStartFrame",
+        0
+    );
+
+    settings.mockFixedLatencyUs = optional<uint64_t>(backend, "mockFixedLatencyUs", 0);
+    settings.mockPerItemLatencyUs = optional<uint64_t>(backend, "mockPerItemLatencyUs", 0);
+    settings.mockLatencyJitterUs = optional<uint64_t>(backend, "mockLatencyJitterUs", 0);
+    settings.mockDetectionsPerFrame = optional<size_t>(backend, "mockDetectionsPerFrame", 10);
+    settings.mockSeed = optional<uint64_t>(backend, "mockSeed", 0);
+
     settings.preProcessingTensorGroups =
         parseTensorGroupList(memory, "preProcessingTensorGroups");
 
@@ -407,6 +570,12 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
     settings.postProcessingTensorGroups =
         parseTensorGroupList(memory, "postProcessingTensorGroups");
 
+    settings.numTensorSlots = optional<size_t>(
+        memory,
+        "numTensorSlots",
+        1
+    );
+
     settings.inputTensorSpecs = parseTensorSpecMap(root, "inputTensorSpecs");
     settings.outputTensorSpecs = parseTensorSpecMap(root, "outputTensorSpecs");
 
@@ -470,5 +639,25 @@ AppSettings loadAppSettingsFromYaml(const fs::path& yamlPath) {
         1
     );
 
+    settings.executionMode = parseExecutionMode(
+        optional<std::string>(execution, "executionMode", "serial")
+    );
+
+    settings.preProcessThreads = optional<size_t>(execution, "preProcessThreads", 1);
+    settings.postProcessThreads = optional<size_t>(execution, "postProcessThreads", 1);
+    settings.preProcessQueueDepth = optional<size_t>(execution, "preProcessQueueDepth", 2);
+    settings.inferenceQueueDepth = optional<size_t>(execution, "inferenceQueueDepth", 2);
+    settings.postProcessQueueDepth = optional<size_t>(execution, "postProcessQueueDepth", 2);
+    settings.sinkQueueDepth = optional<size_t>(execution, "sinkQueueDepth", 2);
+    settings.queueReportInterval = optional<size_t>(execution, "queueReportInterval", 0);
+
+    settings.stageStatsEnabled = optional<bool>(instrumentation, "stageStats", true);
+    settings.stageStatsReportInterval = optional<size_t>(instrumentation, "reportInterval", 0);
+    settings.stageStatsJsonPath = optional<std::string>(instrumentation, "jsonReportPath", "");
+    settings.traceOutputPath = optional<std::string>(instrumentation, "traceOutputPath", "");
+    settings.traceEventsPerThread = optional<size_t>(instrumentation, "traceEventsPerThread", 65536);
+    settings.metricsTextfilePath = optional<std::string>(instrumentation, "metricsTextfilePath", "");
+    settings.metricsExportIntervalMs = optional<size_t>(instrumentation, "metricsExportIntervalMs", 5000);
+
     return settings;
 }
\ No newline at end of file
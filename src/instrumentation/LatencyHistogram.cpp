@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cmath>
+
+#include "instrumentation/LatencyHistogram.hpp"
+
+uint64_t HistogramSnapshot::percentile(double q) const {
+
+    if (count == 0) {
+        return 0;
+    }
+
+    const double clamped = std::clamp(q, 0.0, 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(count))));
+
+    uint64_t seen = 0;
+    for (size_t index = 0; index < buckets.size(); ++index) {
+        seen += buckets[index];
+        if (seen >= rank) {
+            return std::min(LatencyHistogram::bucketUpperBound(index), max);
+        }
+    }
+    return max;
+}
+
+HistogramSnapshot HistogramSnapshot::since(const HistogramSnapshot& earlier) const {
+
+    HistogramSnapshot interval;
+    interval.buckets.resize(buckets.size());
+    interval.count = count - earlier.count;
+    interval.sum = sum - earlier.sum;
+
+    for (size_t index = 0; index < buckets.size(); ++index) {
+        const uint64_t before = index < earlier.buckets.size() ? earlier.buckets[index] : 0;
+        interval.buckets[index] = buckets[index] - before;
+        if (interval.buckets[index] > 0) {
+            interval.max = std::min(LatencyHistogram::bucketUpperBound(index), max);
+        }
+    }
+
+    return interval;
+}
+
+HistogramSnapshot LatencyHistogram::snapshot() const {
+
+    HistogramSnapshot copy;
+    copy.buckets.resize(NUM_BUCKETS);
+
+    for (size_t index = 0; index < NUM_BUCKETS; ++index) {
+        copy.buckets[index] = m_buckets[index].load(std::memory_order_relaxed);
+    }
+    copy.count = m_count.load(std::memory_order_relaxed);
+    copy.sum = m_sum.load(std::memory_order_relaxed);
+    copy.max = m_max.load(std::memory_order_relaxed);
+
+    return copy;
+}
@@ -0,0 +1,96 @@
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include "instrumentation/MetricsExporter.hpp"
+
+
+MetricsTextfileExporter::MetricsTextfileExporter(
+    const MetricsRegistry& registry,
+    const StageStatistics* stageStats,
+    fs::path path,
+    std::chrono::milliseconds interval,
+    BaseLogger& logger
+):
+    m_registry(registry),
+    m_stageStats(stageStats),
+    m_path(std::move(path)),
+    m_interval(interval),
+    m_logger(logger) {
+
+    if (m_interval.count() <= 0) {
+        throw std::runtime_error("Metrics export interval must be positive");
+    }
+
+    if (m_path.has_parent_path()) {
+        fs::create_directories(m_path.parent_path());
+    }
+
+    m_thread = std::thread([this]() { exportLoop(); });
+}
+
+MetricsTextfileExporter::~MetricsTextfileExporter() {
+    try {
+        stop();
+    } catch (const std::exception& e) {
+        m_logger.logConcatMessage(LoggingSeverityType::ERROR, "Final metrics export failed: ", e.what(), '\n');
+    }
+}
+
+void MetricsTextfileExporter::stop() {
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) {
+            return;
+        }
+        m_stopping = true;
+    }
+    m_wakeup.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    writeNow();
+}
+
+void MetricsTextfileExporter::writeNow() const {
+
+    std::string text = m_registry.render();
+    if (m_stageStats) {
+        text += StageStatistics::formatPrometheus(m_stageStats->snapshot());
+    }
+
+    fs::path tmpPath = m_path;
+    tmpPath += ".tmp";
+
+    {
+        std::ofstream file(tmpPath, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open metrics file: " + tmpPath.string());
+        }
+        file << text;
+        if (!file) {
+            throw std::runtime_error("Failed to write metrics file: " + tmpPath.string());
+        }
+    }
+
+    fs::rename(tmpPath, m_path);
+}
+
+void MetricsTextfileExporter::exportLoop() {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_wakeup.wait_for(lock, m_interval, [this]() { return m_stopping; })) {
+        lock.unlock();
+        try {
+            writeNow();
+        } catch (const std::exception& e) {
+            // A transient export failure must not take the pipeline down.
+            m_logger.logConcatMessage(LoggingSeverityType::WARNING, "Metrics export failed: ", e.what(), '\n');
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,149 @@
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "instrumentation/MetricsRegistry.hpp"
+
+namespace {
+
+/**
+ * @brief Metric name with an optional label set, e.g. `name{a="b"}`.
+ */
+std::string series(const std::string& name, const std::string& labels) {
+    return labels.empty() ? name : name + '{' + labels + '}';
+}
+
+/**
+ * @brief Join preformatted label sets, skipping empty ones.
+ */
+std::string joinLabels(const std::string& labels, const std::string& extra) {
+    if (labels.empty()) {
+        return extra;
+    }
+    return labels + ',' + extra;
+}
+
+} // namespace
+
+
+Histogram::Histogram(std::vector<double> upperBounds):
+    m_upperBounds(std::move(upperBounds)),
+    m_counts(new std::atomic<uint64_t>[m_upperBounds.size() + 1]) {
+
+    for (size_t i = 0; i <= m_upperBounds.size(); ++i) {
+        m_counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+std::vector<uint64_t> Histogram::bucketCounts() const {
+
+    std::vector<uint64_t> counts(m_upperBounds.size() + 1);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = m_counts[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+
+MetricsRegistry& MetricsRegistry::global() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricsRegistry::Family& MetricsRegistry::family(const std::string& name, const std::string& help, MetricType type) {
+
+    auto [it, inserted] = m_families.try_emplace(name);
+    if (inserted) {
+        it->second.type = type;
+        it->second.help = help;
+    } else if (it->second.type != type) {
+        throw std::runtime_error("Metric registered twice with different types: " + name);
+    }
+    return it->second;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help, const std::string& labels) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<Counter>& metric = family(name, help, MetricType::COUNTER).counters[labels];
+    if (!metric) {
+        metric = std::make_unique<Counter>();
+    }
+    return *metric;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help, const std::string& labels) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<Gauge>& metric = family(name, help, MetricType::GAUGE).gauges[labels];
+    if (!metric) {
+        metric = std::make_unique<Gauge>();
+    }
+    return *metric;
+}
+
+Histogram& MetricsRegistry::histogram(
+    const std::string& name,
+    const std::string& help,
+    const std::vector<double>& upperBounds,
+    const std::string& labels
+) {
+
+    for (size_t i = 1; i < upperBounds.size(); ++i) {
+        if (!(upperBounds[i] > upperBounds[i - 1])) {
+            throw std::runtime_error("Histogram bounds must be strictly increasing: " + name);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<Histogram>& metric = family(name, help, MetricType::HISTOGRAM).histograms[labels];
+    if (!metric) {
+        metric = std::make_unique<Histogram>(upperBounds);
+    }
+    return *metric;
+}
+
+std::string MetricsRegistry::render() const {
+
+    std::ostringstream text;
+    text.precision(std::numeric_limits<double>::max_digits10);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [name, family] : m_families) {
+        text << "# HELP " << name << ' ' << family.help << '\n';
+        const char* typeName = family.type == MetricType::COUNTER ? "counter"
+            : family.type == MetricType::GAUGE ? "gauge"
+            : "histogram";
+        text << "# TYPE " << name << ' ' << typeName << '\n';
+
+        for (const auto& [labels, counter] : family.counters) {
+            text << series(name, labels) << ' ' << counter->value() << '\n';
+        }
+
+        for (const auto& [labels, gauge] : family.gauges) {
+            text << series(name, labels) << ' ' << gauge->value() << '\n';
+        }
+
+        for (const auto& [labels, histogram] : family.histograms) {
+            const std::vector<uint64_t> counts = histogram->bucketCounts();
+            const std::vector<double>& bounds = histogram->upperBounds();
+
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                cumulative += counts[i];
+                std::ostringstream bound;
+                bound << bounds[i];
+                text << series(name + "_bucket", joinLabels(labels, "le=\"" + bound.str() + '"'))
+                     << ' ' << cumulative << '\n';
+            }
+            cumulative += counts.back();
+            text << series(name + "_bucket", joinLabels(labels, "le=\"+Inf\"")) << ' ' << cumulative << '\n';
+            text << series(name + "_sum", labels) << ' ' << histogram->sum() << '\n';
+            text << series(name + "_count", labels) << ' ' << cumulative << '\n';
+        }
+    }
+
+    return text.str();
+}
@@ -0,0 +1,213 @@
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "instrumentation/StageStatistics.hpp"
+
+namespace {
+
+constexpr double NS_PER_MS = 1e6;
+constexpr double NS_PER_S = 1e9;
+
+/**
+ * @brief Derived per-stage figures shared by the text and JSON reports.
+ */
+struct StageSummary {
+    uint64_t batches = 0;
+    uint64_t frames = 0;
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p90Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double batchesPerSecond = 0.0;
+    double wallFps = 0.0;
+    double busyFps = 0.0;
+};
+
+StageSummary summarize(const StageStatisticsSnapshot& snapshot, size_t stageIdx) {
+
+    const HistogramSnapshot& latency = snapshot.latency[stageIdx];
+    StageSummary summary;
+
+    summary.batches = latency.count;
+    summary.frames = snapshot.frames[stageIdx];
+    summary.meanMs = latency.mean() / NS_PER_MS;
+    summary.p50Ms = static_cast<double>(latency.percentile(0.50)) / NS_PER_MS;
+    summary.p90Ms = static_cast<double>(latency.percentile(0.90)) / NS_PER_MS;
+    summary.p99Ms = static_cast<double>(latency.percentile(0.99)) / NS_PER_MS;
+    summary.maxMs = static_cast<double>(latency.max) / NS_PER_MS;
+
+    if (snapshot.elapsedSeconds > 0.0) {
+        summary.batchesPerSecond = static_cast<double>(summary.batches) / snapshot.elapsedSeconds;
+        summary.wallFps = static_cast<double>(summary.frames) / snapshot.elapsedSeconds;
+    }
+
+    // Frames per second of time spent inside the stage: the stage's capacity per worker.
+    if (latency.sum > 0) {
+        summary.busyFps = static_cast<double>(summary.frames) / (static_cast<double>(latency.sum) / NS_PER_S);
+    }
+
+    return summary;
+}
+
+} // namespace
+
+
+StageStatisticsSnapshot StageStatisticsSnapshot::since(const StageStatisticsSnapshot& earlier) const {
+
+    StageStatisticsSnapshot interval;
+
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        interval.latency[stageIdx] = latency[stageIdx].since(earlier.latency[stageIdx]);
+        interval.frames[stageIdx] = frames[stageIdx] - earlier.frames[stageIdx];
+    }
+    interval.elapsedSeconds = elapsedSeconds - earlier.elapsedSeconds;
+
+    return interval;
+}
+
+
+StageStatistics::StageStatistics():
+    m_startTime(std::chrono::steady_clock::now()) {}
+
+StageStatisticsSnapshot StageStatistics::snapshot() const {
+
+    StageStatisticsSnapshot copy;
+
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        copy.latency[stageIdx] = m_stages[stageIdx].latency.snapshot();
+        copy.frames[stageIdx] = m_stages[stageIdx].frames.load(std::memory_order_relaxed);
+    }
+    copy.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+
+    return copy;
+}
+
+void StageStatistics::logIntervalReport(BaseLogger& logger) {
+
+    const StageStatisticsSnapshot current = snapshot();
+    const StageStatisticsSnapshot interval = current.since(m_lastReport);
+    m_lastReport = current;
+
+    logger.logConcatMessage(LoggingSeverityType::INFO, formatText(interval, "Stage latency (interval)"));
+}
+
+void StageStatistics::logFinalReport(BaseLogger& logger, const fs::path& jsonPath) {
+
+    const StageStatisticsSnapshot total = snapshot();
+
+    logger.logConcatMessage(LoggingSeverityType::INFO, formatText(total, "Stage latency (final)"));
+
+    if (jsonPath.empty()) {
+        return;
+    }
+
+    if (jsonPath.has_parent_path()) {
+        fs::create_directories(jsonPath.parent_path());
+    }
+
+    std::ofstream jsonFile(jsonPath);
+    if (!jsonFile.is_open()) {
+        throw std::runtime_error("Failed to open stage statistics file: " + jsonPath.string());
+    }
+    jsonFile << formatJson(total) << '\n';
+
+    logger.logConcatMessage(LoggingSeverityType::INFO, "Stage statistics written to ", jsonPath.string(), '\n');
+}
+
+std::string StageStatistics::formatText(const StageStatisticsSnapshot& snapshot, const std::string& label) {
+
+    std::ostringstream report;
+    report << label << " over " << std::fixed << std::setprecision(2) << snapshot.elapsedSeconds << " s\n";
+    report << "  " << std::left << std::setw(12) << "stage" << std::right
+           << std::setw(9) << "batches" << std::setw(9) << "frames"
+           << std::setw(10) << "mean_ms" << std::setw(10) << "p50_ms"
+           << std::setw(10) << "p90_ms" << std::setw(10) << "p99_ms"
+           << std::setw(10) << "max_ms" << std::setw(10) << "batch/s"
+           << std::setw(10) << "fps" << std::setw(11) << "busy_fps" << '\n';
+
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        const StageSummary summary = summarize(snapshot, stageIdx);
+        if (summary.batches == 0) {
+            continue;
+        }
+
+        report << "  " << std::left << std::setw(12) << pipelineStageName(static_cast<PipelineStage>(stageIdx))
+               << std::right << std::setprecision(3)
+               << std::setw(9) << summary.batches << std::setw(9) << summary.frames
+               << std::setw(10) << summary.meanMs << std::setw(10) << summary.p50Ms
+               << std::setw(10) << summary.p90Ms << std::setw(10) << summary.p99Ms
+               << std::setw(10) << summary.maxMs
+               << std::setprecision(1)
+               << std::setw(10) << summary.batchesPerSecond << std::setw(10) << summary.wallFps
+               << std::setw(11) << summary.busyFps << '\n';
+    }
+
+    return report.str();
+}
+
+std::string StageStatistics::formatJson(const StageStatisticsSnapshot& snapshot) {
+
+    std::ostringstream json;
+    json << std::setprecision(6) << "{\"elapsedSeconds\":" << snapshot.elapsedSeconds << ",\"stages\":[";
+
+    bool first = true;
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        const StageSummary summary = summarize(snapshot, stageIdx);
+        if (summary.batches == 0) {
+            continue;
+        }
+
+        json << (first ? "" : ",")
+             << "{\"stage\":\"" << pipelineStageName(static_cast<PipelineStage>(stageIdx)) << '"'
+             << ",\"batches\":" << summary.batches
+             << ",\"frames\":" << summary.frames
+             << ",\"meanMs\":" << summary.meanMs
+             << ",\"p50Ms\":" << summary.p50Ms
+             << ",\"p90Ms\":" << summary.p90Ms
+             << ",\"p99Ms\":" << summary.p99Ms
+             << ",\"maxMs\":" << summary.maxMs
+             << ",\"batchesPerSecond\":" << summary.batchesPerSecond
+             << ",\"fps\":" << summary.wallFps
+             << ",\"busyFps\":" << summary.busyFps
+             << '}';
+        first = false;
+    }
+
+    json << "]}";
+    return json.str();
+}
+
+std::string StageStatistics::formatPrometheus(const StageStatisticsSnapshot& snapshot) {
+
+    constexpr double quantiles[] = {0.5, 0.9, 0.99};
+
+    std::ostringstream text;
+    text << std::setprecision(9);
+
+    text << "# HELP yoloseg_stage_latency_seconds Batch latency of each pipeline stage.\n"
+         << "# TYPE yoloseg_stage_latency_seconds summary\n";
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        const HistogramSnapshot& latency = snapshot.latency[stageIdx];
+        const char* stage = pipelineStageName(static_cast<PipelineStage>(stageIdx));
+
+        for (const double q : quantiles) {
+            text << "yoloseg_stage_latency_seconds{stage=\"" << stage << "\",quantile=\"" << q << "\"} "
+                 << static_cast<double>(latency.percentile(q)) / NS_PER_S << '\n';
+        }
+        text << "yoloseg_stage_latency_seconds_sum{stage=\"" << stage << "\"} "
+             << static_cast<double>(latency.sum) / NS_PER_S << '\n';
+        text << "yoloseg_stage_latency_seconds_count{stage=\"" << stage << "\"} " << latency.count << '\n';
+    }
+
+    text << "# HELP yoloseg_stage_frames_total Source frames processed by each pipeline stage.\n"
+         << "# TYPE yoloseg_stage_frames_total counter\n";
+    for (size_t stageIdx = 0; stageIdx < NUM_PIPELINE_STAGES; ++stageIdx) {
+        text << "yoloseg_stage_frames_total{stage=\"" << pipelineStageName(static_cast<PipelineStage>(stageIdx))
+             << "\"} " << snapshot.frames[stageIdx] << '\n';
+    }
+
+    return text.str();
+}
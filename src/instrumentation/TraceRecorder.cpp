@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "instrumentation/TraceRecorder.hpp"
+
+namespace {
+
+constexpr int TRACE_PROCESS_ID = 1;
+
+std::atomic<uint64_t> g_nextRecorderId{1};
+
+/**
+ * @brief Per-thread cache of the buffer registered with the most recently used recorder.
+ */
+struct ThreadBufferCache {
+    uint64_t recorderId = 0;
+    void* buffer = nullptr;
+};
+
+thread_local ThreadBufferCache t_bufferCache;
+
+uint64_t currentThreadId() {
+    return static_cast<uint64_t>(::syscall(SYS_gettid));
+}
+
+std::string escapeJson(const std::string& text) {
+
+    std::string escaped;
+    escaped.reserve(text.size());
+
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief A recorded span together with the thread that produced it.
+ */
+struct ThreadEvent {
+    uint64_t threadId;
+    const TraceEvent* event;
+};
+
+} // namespace
+
+
+TraceRecorder::TraceRecorder(size_t eventsPerThread):
+    m_recorderId(g_nextRecorderId.fetch_add(1, std::memory_order_relaxed)),
+    m_eventsPerThread(eventsPerThread),
+    m_startTime(std::chrono::steady_clock::now()) {
+
+    if (m_eventsPerThread == 0) {
+        throw std::runtime_error("TraceRecorder requires a non-zero per-thread event capacity");
+    }
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::localBuffer() {
+
+    if (t_bufferCache.recorderId == m_recorderId) {
+        return *static_cast<ThreadBuffer*>(t_bufferCache.buffer);
+    }
+
+    const uint64_t threadId = currentThreadId();
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+
+    ThreadBuffer* buffer = nullptr;
+    for (const std::unique_ptr<ThreadBuffer>& candidate : m_buffers) {
+        if (candidate->threadId == threadId) {
+            buffer = candidate.get();
+            break;
+        }
+    }
+
+    if (!buffer) {
+        auto created = std::make_unique<ThreadBuffer>();
+        created->threadId = threadId;
+        created->events.resize(m_eventsPerThread);
+        buffer = created.get();
+        m_buffers.push_back(std::move(created));
+    }
+
+    t_bufferCache.recorderId = m_recorderId;
+    t_bufferCache.buffer = buffer;
+    return *buffer;
+}
+
+void TraceRecorder::record(const TraceEvent& event) {
+
+    ThreadBuffer& buffer = localBuffer();
+
+    // Only the owning thread writes, so a relaxed read of its own size is current.
+    const size_t size = buffer.size.load(std::memory_order_relaxed);
+    if (size >= buffer.events.size()) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[size] = event;
+    buffer.size.store(size + 1, std::memory_order_release);
+}
+
+void TraceRecorder::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    buffer.threadName = name;
+}
+
+uint64_t TraceRecorder::droppedEvents() const {
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    uint64_t dropped = 0;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+size_t TraceRecorder::recordedEvents() const {
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    size_t recorded = 0;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        recorded += buffer->size.load(std::memory_order_acquire);
+    }
+    return recorded;
+}
+
+void TraceRecorder::write(const fs::path& path) const {
+
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path());
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open trace file: " + path.string());
+    }
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+
+    // Chrome trace timestamps are microseconds; keep nanosecond resolution as decimals.
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << TRACE_PROCESS_ID
+         << ",\"args\":{\"name\":\"yolo-seg pipeline\"}}";
+
+    std::vector<ThreadEvent> allEvents;
+
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        const std::string threadName = buffer->threadName.empty()
+            ? "thread-" + std::to_string(buffer->threadId)
+            : buffer->threadName;
+
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << TRACE_PROCESS_ID
+             << ",\"tid\":" << buffer->threadId
+             << ",\"args\":{\"name\":\"" << escapeJson(threadName) << "\"}}";
+
+        const size_t size = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < size; ++i) {
+            const TraceEvent& event = buffer->events[i];
+            allEvents.push_back({buffer->threadId, &event});
+
+            file << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"stage\",\"ph\":\"X\""
+                 << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << buffer->threadId
+                 << ",\"ts\":" << static_cast<double>(event.startNs) / 1e3
+                 << ",\"dur\":" << static_cast<double>(event.durationNs) / 1e3
+                 << ",\"args\":{\"thread\":" << buffer->threadId << ",\"batch\":" << event.batchId;
+            if (event.frameId != TRACE_NO_FRAME) {
+                file << ",\"frame\":" << event.frameId;
+            }
+            file << ",\"frames\":" << event.frames << "}}";
+        }
+    }
+
+    // Link consecutive spans of the same batch that hand over between threads.
+    std::sort(allEvents.begin(), allEvents.end(), [](const ThreadEvent& lhs, const ThreadEvent& rhs) {
+        if (lhs.event->batchId != rhs.event->batchId) {
+            return lhs.event->batchId < rhs.event->batchId;
+        }
+        return lhs.event->startNs < rhs.event->startNs;
+    });
+
+    uint64_t flowId = 0;
+    for (size_t i = 1; i < allEvents.size(); ++i) {
+        const ThreadEvent& from = allEvents[i - 1];
+        const ThreadEvent& to = allEvents[i];
+
+        if (from.event->batchId != to.event->batchId || from.threadId == to.threadId) {
+            continue;
+        }
+
+        file << ",\n{\"name\":\"batch\",\"cat\":\"flow\",\"ph\":\"s\",\"id\":" << flowId
+             << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << from.threadId
+             << ",\"ts\":" << static_cast<double>(from.event->startNs) / 1e3 << '}';
+        file << ",\n{\"name\":\"batch\",\"cat\":\"flow\",\"ph\":\"f\",\"bp\":\"e\",\"id\":" << flowId
+             << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << to.threadId
+             << ",\"ts\":" << static_cast<double>(to.event->startNs) / 1e3 << '}';
+        ++flowId;
+    }
+
+    file << "\n]}\n";
+
+    if (!file) {
+        throw std::runtime_error("Failed to write trace file: " + path.string());
+    }
+}
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <iostream>
 
 #include "logging/BaseLogger.hpp"
@@ -5,6 +6,10 @@
 namespace {
 constexpr const char* DEFAULT_LOG_FILE = "main.log";
 constexpr LoggingSeverityType DEFAULT_LOG_SEVERITY = LoggingSeverityType::INFO;
+
+// Idle wait of the asynchronous writer and of flush(); log latency is not critical.
+constexpr std::chrono::microseconds WRITER_IDLE_SLEEP{500};
+constexpr std::chrono::microseconds FLUSH_POLL_SLEEP{50};
 } // namespace
 
 bool BaseLogger::assignStream(){
@@ -39,28 +44,137 @@ BaseLogger::BaseLogger(const fs::path& fileName, LoggingSeverityType severity):
         assignStream();
     }
 
+BaseLogger::BaseLogger(
+    const fs::path& fileName,
+    LoggingSeverityType severity,
+    LoggingMode mode,
+    size_t asyncQueueCapacity
+):
+    m_severity(severity),
+    m_mode(mode),
+    m_logFilePath(fileName) {
+        assignStream();
+
+        if (m_mode == LoggingMode::ASYNC) {
+            m_queue = std::make_unique<LogRecordQueue>(asyncQueueCapacity);
+            m_writer = std::thread([this]() { writerLoop(); });
+        }
+    }
+
+BaseLogger::~BaseLogger() {
+    if (m_writer.joinable()) {
+        m_stopWriter.store(true, std::memory_order_release);
+        m_writer.join();
+    }
+}
+
+const char* BaseLogger::severityPrefix(LoggingSeverityType severity) noexcept {
+    switch (severity) {
+        case LoggingSeverityType::INTERNAL_ERROR: return "[INTERNAL ERROR] ";
+        case LoggingSeverityType::ERROR: return "[ERROR] ";
+        case LoggingSeverityType::WARNING: return "[WARNING] ";
+        default: return "[INFO] ";
+    }
+}
+
+std::ostringstream& BaseLogger::threadFormatStream() {
+    thread_local std::ostringstream stream;
+    stream.str(std::string());
+    stream.clear();
+    return stream;
+}
+
+void BaseLogger::enqueue(LoggingSeverityType severity, std::string text) {
+
+    LogRecord record{severity, std::move(text)};
+
+    if (severity >= LoggingSeverityType::WARNING) {
+        while (!m_queue->tryPush(record)) {
+            std::this_thread::yield();
+        }
+    } else if (!m_queue->tryPush(record)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    m_enqueued.fetch_add(1, std::memory_order_release);
+
+    if (severity >= LoggingSeverityType::ERROR) {
+        flush();
+    }
+}
+
+void BaseLogger::flush() {
+
+    if (m_mode != LoggingMode::ASYNC) {
+        std::lock_guard<std::mutex> lock(m_loggerMutex);
+        m_logStream.flush();
+        return;
+    }
+
+    const uint64_t target = m_enqueued.load(std::memory_order_acquire);
+    while (m_written.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(FLUSH_POLL_SLEEP);
+    }
+}
+
+void BaseLogger::writerLoop() {
+
+    LogRecord record;
+    uint64_t written = 0;
+    uint64_t reportedDrops = 0;
+
+    while (true) {
+        const bool stopping = m_stopWriter.load(std::memory_order_acquire);
+
+        size_t drained = 0;
+        while (m_queue->tryPop(record)) {
+            m_logStream << record.text;
+            ++drained;
+        }
+
+        const uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops) {
+            m_logStream << severityPrefix(LoggingSeverityType::WARNING)
+                        << "Logger queue full, dropped " << (dropped - reportedDrops) << " message(s)\n";
+            reportedDrops = dropped;
+        }
+
+        if (drained > 0) {
+            m_logStream.flush();
+            written += drained;
+            m_written.store(written, std::memory_order_release);
+        } else if (stopping) {
+            break;
+        } else {
+            std::this_thread::sleep_for(WRITER_IDLE_SLEEP);
+        }
+    }
+
+    m_logStream.flush();
+}
+
 void BaseLogger::log(LoggingSeverityType severity, const char* msg) noexcept {
-    
+
+    if (!isEnabled(severity)) {
+        return;
+    }
+
     try {
 
-        std::lock_guard<std::mutex> lock(m_loggerMutex);
-        
-        if(severity >= m_severity) {
-            if(severity == LoggingSeverityType::INTERNAL_ERROR)
-                m_logStream << "[INTERNAL ERROR] " << msg << '\n';
-
-            else if(severity == LoggingSeverityType::ERROR)
-                m_logStream << "[ERROR] " << msg << '\n';
-
-            else if(severity == LoggingSeverityType::WARNING)
-                m_logStream << "[WARNING] " << msg << '\n';
-            
-            else
-                m_logStream << "[INFO] " << msg << '\n';
+        if (m_mode == LoggingMode::ASYNC) {
+            std::string text(severityPrefix(severity));
+            text += msg;
+            text += '\n';
+            enqueue(severity, std::move(text));
+            return;
         }
 
+        std::lock_guard<std::mutex> lock(m_loggerMutex);
+        m_logStream << severityPrefix(severity) << msg << '\n';
+
     } catch (const std::exception& e) {
         std::cerr << "Unknown logger failure \n" << e.what();
     }
         
-}
\ No newline at end of file
+}
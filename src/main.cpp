@@ -4,6 +4,8 @@
 #include <cxxopts.hpp>
 
 #include "application/Application.hpp"
+#include "source/utils/RawPackedFormat.hpp"
+#include "source/utils/SharedFrameRing.hpp"
 
 namespace fs = std::filesystem;
 
@@ -16,6 +18,13 @@ int main(int argc, const char* argv[]) {
 
         options.add_options()
             ("c,config", "YAML configuration file", cxxopts::value<fs::path>())
+            ("pack-folder", "Convert an image folder to a raw packed frame file and exit", cxxopts::value<fs::path>())
+            ("pack-output", "Raw packed file written by --pack-folder", cxxopts::value<fs::path>())
+            ("pack-height", "Frame height for --pack-folder, 0 = first image", cxxopts::value<size_t>()->default_value("0"))
+            ("pack-width", "Frame width for --pack-folder, 0 = first image", cxxopts::value<size_t>()->default_value("0"))
+            ("shm-produce", "Publish an image folder through a shared-memory frame ring of this name and exit", cxxopts::value<std::string>())
+            ("shm-input", "Image folder published by --shm-produce", cxxopts::value<fs::path>())
+            ("shm-slots", "Ring slots for --shm-produce", cxxopts::value<uint32_t>()->default_value("8"))
             ("h,help", "Print usage");
         options.parse_positional({"config"});
         options.positional_help("<config.yaml>");
@@ -27,6 +36,39 @@ int main(int argc, const char* argv[]) {
             return 0;
         }
 
+        if (result.count("pack-folder")) {
+            if (!result.count("pack-output")) {
+                std::cerr << "--pack-folder requires --pack-output.\n";
+                return 1;
+            }
+
+            const fs::path packOutput = result["pack-output"].as<fs::path>();
+            const size_t packedFrames = packImageFolder(
+                result["pack-folder"].as<fs::path>(),
+                packOutput,
+                result["pack-height"].as<size_t>(),
+                result["pack-width"].as<size_t>()
+            );
+            std::cout << "Packed " << packedFrames << " frames into " << packOutput << '\n';
+            return 0;
+        }
+
+        if (result.count("shm-produce")) {
+            if (!result.count("shm-input")) {
+                std::cerr << "--shm-produce requires --shm-input.\n";
+                return 1;
+            }
+
+            const std::string ringName = result["shm-produce"].as<std::string>();
+            const size_t publishedFrames = publishImageFolder(
+                ringName,
+                result["shm-input"].as<fs::path>(),
+                result["shm-slots"].as<uint32_t>()
+            );
+            std::cout << "Published " << publishedFrames << " frames through " << ringName << '\n';
+            return 0;
+        }
+
         if (!result.count("config")) {
             std::cerr << "Missing YAML configuration file.\n\n";
             std::cerr << options.help() << '\n';
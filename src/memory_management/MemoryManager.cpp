@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <sstream>
 #include <utility>
 
 namespace {
@@ -43,8 +44,14 @@ bool hasUnifiedMemoryBuffer(const TensorViewMap& tensorMap) {
 } // namespace
 
 
-MemoryManager::MemoryManager(TensorGroupConfig groupLists):
-    m_groupLists(std::move(groupLists)) {}
+MemoryManager::MemoryManager(TensorGroupConfig groupLists, size_t numSlots):
+    m_groupLists(std::move(groupLists)) {
+
+    if (numSlots == 0) {
+        throw std::runtime_error("MemoryManager requires at least one tensor slot");
+    }
+    m_slots.resize(numSlots);
+}
 
 bool MemoryManager::supportsGroup(TensorGroup group) const {
     const std::vector<TensorGroup> groups = allConfiguredGroups();
@@ -52,7 +59,8 @@ bool MemoryManager::supportsGroup(TensorGroup group) const {
 }
 
 bool MemoryManager::hasAllocatedGroup(TensorGroup group) const {
-    return m_TensorViewsByGroup.find(group) != m_TensorViewsByGroup.end();
+    const auto& tensorViewsByGroup = m_slots.front().tensorViewsByGroup;
+    return tensorViewsByGroup.find(group) != tensorViewsByGroup.end();
 }
 
 void MemoryManager::allocateTensorsForGroup(const TensorSpecMap& tensorSpecs, TensorGroup group) {
@@ -64,46 +72,53 @@ void MemoryManager::allocateTensorsForGroup(const TensorSpecMap& tensorSpecs, Te
         throw std::runtime_error("Duplicate tensor group allocation");
     }
 
+    for (TensorSlot& slot : m_slots) {
+        allocateSlotGroup(slot, tensorSpecs, group);
+    }
+}
+
+void MemoryManager::allocateSlotGroup(TensorSlot& slot, const TensorSpecMap& tensorSpecs, TensorGroup group) {
+
     switch (group) {
         case TensorGroup::HostInput:
-            allocateBuffers(m_hostInputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_hostInputs));
+            allocateBuffers(slot.hostInputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.hostInputs));
             break;
         case TensorGroup::PinnedInput:
-            allocateBuffers(m_pinnedInputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_pinnedInputs));
+            allocateBuffers(slot.pinnedInputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.pinnedInputs));
             break;
         case TensorGroup::DeviceInput:
-            allocateBuffers(m_deviceInputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_deviceInputs));
+            allocateBuffers(slot.deviceInputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.deviceInputs));
             break;
         case TensorGroup::UnifiedInput:
-            allocateBuffers(m_unifiedInputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_unifiedInputs));
+            allocateBuffers(slot.unifiedInputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.unifiedInputs));
             break;
         case TensorGroup::HostOutput:
-            allocateBuffers(m_hostOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_hostOutputs));
+            allocateBuffers(slot.hostOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.hostOutputs));
             break;
         case TensorGroup::PinnedOutput:
-            allocateBuffers(m_pinnedOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_pinnedOutputs));
+            allocateBuffers(slot.pinnedOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.pinnedOutputs));
             break;
         case TensorGroup::DeviceOutput:
-            allocateBuffers(m_deviceOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_deviceOutputs));
+            allocateBuffers(slot.deviceOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.deviceOutputs));
             break;
         case TensorGroup::UnifiedOutput:
-            allocateBuffers(m_unifiedOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_unifiedOutputs));
+            allocateBuffers(slot.unifiedOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.unifiedOutputs));
             break;
         case TensorGroup::HostPostProcessOutput:
-            allocateBuffers(m_hostPostProcessOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_hostPostProcessOutputs));
+            allocateBuffers(slot.hostPostProcessOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.hostPostProcessOutputs));
             break;
         case TensorGroup::DevicePostProcessOutput:
-            allocateBuffers(m_devicePostProcessOutputs, tensorSpecs);
-            m_TensorViewsByGroup.emplace(group, getTensorViews(m_devicePostProcessOutputs));
+            allocateBuffers(slot.devicePostProcessOutputs, tensorSpecs);
+            slot.tensorViewsByGroup.emplace(group, getTensorViews(slot.devicePostProcessOutputs));
             break;
     }
 }
@@ -116,12 +131,46 @@ void MemoryManager::allocateAllTensors(const TensorSpecMap& tensorSpecs) {
     }
 }
 
-TensorViewMap& MemoryManager::getTensorViewsFromGroup(TensorGroup group) {
-    return m_TensorViewsByGroup.at(group);
+TensorViewMap& MemoryManager::getTensorViewsFromGroup(TensorGroup group, size_t slot) {
+    return m_slots.at(slot).tensorViewsByGroup.at(group);
 }
 
-const TensorViewMap& MemoryManager::getTensorViewsFromGroup(TensorGroup group) const {
-    return m_TensorViewsByGroup.at(group);
+const TensorViewMap& MemoryManager::getTensorViewsFromGroup(TensorGroup group, size_t slot) const {
+    return m_slots.at(slot).tensorViewsByGroup.at(group);
+}
+
+void MemoryManager::logMemoryUsage(BaseLogger& logger) const {
+
+    size_t totalBytes = 0;
+
+    for (size_t slotIdx = 0; slotIdx < m_slots.size(); ++slotIdx) {
+        std::ostringstream report;
+        size_t slotBytes = 0;
+
+        report << "Tensor slot " << slotIdx << ':';
+        for (TensorGroup group : allConfiguredGroups()) {
+            const auto it = m_slots[slotIdx].tensorViewsByGroup.find(group);
+            if (it == m_slots[slotIdx].tensorViewsByGroup.end()) {
+                continue;
+            }
+
+            size_t groupBytes = 0;
+            for (const auto& [name, view] : it->second) {
+                groupBytes += view.totalBytes;
+            }
+            slotBytes += groupBytes;
+            report << ' ' << tensorGroupName(group) << '=' << groupBytes << 'B';
+        }
+        report << ", slot total=" << slotBytes << 'B';
+
+        totalBytes += slotBytes;
+        logger.logConcatMessage(LoggingSeverityType::INFO, report.str(), '\n');
+    }
+
+    logger.logConcatMessage(
+        LoggingSeverityType::INFO,
+        "Tensor memory across ", m_slots.size(), " slot(s): ", totalBytes, " bytes\n"
+    );
 }
 
 std::vector<TensorGroup> MemoryManager::allConfiguredGroups() const {
@@ -222,10 +271,11 @@ void MemoryManager::appendUnifiedReadiness(
 
 std::vector<TensorTransfer> MemoryManager::makeTransfers(
     TensorGroup sourceGroup,
-    TensorGroup targetGroup
+    TensorGroup targetGroup,
+    size_t slot
 ) {
-    auto& sourceBufferViews = getTensorViewsFromGroup(sourceGroup);
-    auto& targetBufferViews = getTensorViewsFromGroup(targetGroup);
+    auto& sourceBufferViews = getTensorViewsFromGroup(sourceGroup, slot);
+    auto& targetBufferViews = getTensorViewsFromGroup(targetGroup, slot);
     const DeviceType sourceDevice = getTensorViewDevice(sourceBufferViews);
     const DeviceType targetDevice = getTensorViewDevice(targetBufferViews);
 
@@ -248,7 +298,7 @@ std::vector<TensorTransfer> MemoryManager::makeTransfers(
     return transfers;
 }
 
-PipelineTensorContext MemoryManager::createPipelineTensorContext() {
+PipelineTensorContext MemoryManager::createPipelineTensorContext(size_t slot) {
 
     const TensorGroup preProcessingGroup = selectFirstAllocatedGroup(
         m_groupLists.preProcessing,
@@ -261,10 +311,10 @@ PipelineTensorContext MemoryManager::createPipelineTensorContext() {
         "postprocessing"
     );
 
-    auto& preProcessingBufferViews = getTensorViewsFromGroup(preProcessingGroup);
-    auto& configuredInferenceInputBufferViews = getTensorViewsFromGroup(inferenceInputGroup);
-    auto& inferenceOutputBufferViews = getTensorViewsFromGroup(inferenceOutputGroup);
-    auto& configuredPostProcessingBufferViews = getTensorViewsFromGroup(postProcessingGroup);
+    auto& preProcessingBufferViews = getTensorViewsFromGroup(preProcessingGroup, slot);
+    auto& configuredInferenceInputBufferViews = getTensorViewsFromGroup(inferenceInputGroup, slot);
+    auto& inferenceOutputBufferViews = getTensorViewsFromGroup(inferenceOutputGroup, slot);
+    auto& configuredPostProcessingBufferViews = getTensorViewsFromGroup(postProcessingGroup, slot);
 
     const bool aliasPreProcessingIntoInference =
         preProcessingGroup == inferenceInputGroup ||
@@ -303,7 +353,7 @@ PipelineTensorContext MemoryManager::createPipelineTensorContext() {
 
     for (TensorGroup group : m_groupLists.inference) {
         if (hasAllocatedGroup(group)) {
-            std::reference_wrapper<TensorViewMap> bindableMap = getTensorViewsFromGroup(group);
+            std::reference_wrapper<TensorViewMap> bindableMap = getTensorViewsFromGroup(group, slot);
             if (group == inferenceInputGroup) {
                 bindableMap = effectiveInferenceInputBufferViews;
             }
@@ -330,11 +380,23 @@ PipelineTensorContext MemoryManager::createPipelineTensorContext() {
             .bufferViews = effectivePostProcessingBufferViews,
             .group = effectivePostProcessingGroup
         },
-        .preProcessingToInference = makeTransfers(preProcessingGroup, inferenceInputGroup),
-        .inferenceToPostProcessing = makeTransfers(inferenceOutputGroup, postProcessingGroup)
+        .preProcessingToInference = makeTransfers(preProcessingGroup, inferenceInputGroup, slot),
+        .inferenceToPostProcessing = makeTransfers(inferenceOutputGroup, postProcessingGroup, slot)
     };
 }
 
+std::unique_ptr<PipelineTensorContextRing> MemoryManager::createPipelineTensorContextRing() {
+
+    std::vector<PipelineTensorContext> contexts;
+    contexts.reserve(m_slots.size());
+
+    for (size_t slot = 0; slot < m_slots.size(); ++slot) {
+        contexts.push_back(createPipelineTensorContext(slot));
+    }
+
+    return std::make_unique<PipelineTensorContextRing>(std::move(contexts));
+}
+
 void MemoryManager::transferTensors(
     const std::vector<TensorTransfer>& transfers,
     const std::vector<std::string>& TensorKeys,
@@ -11,6 +11,7 @@
 
 #include "post_process/cpu/YoloSegCpuPostProcessorSimple.hpp"
 #include "post_process/utils/MatUtils.hpp"
+#include "logging/LogMacros.hpp"
 #include "core/tensor.hpp"
 
 
@@ -75,8 +76,10 @@ void YoloSegCpuPostProcessorSimple::process(
         std::vector<float> candScores;
         std::vector<size_t> candObjIndexes, candLabels;
 
-        const size_t origImgW = processedBatch[b].metadata.originalWidth;
-        const size_t origImgH = processedBatch[b].metadata.originalHeight;
+        // Letterboxed outputs are in network input pixels and mapped back to the frame per detection.
+        const FrameMetadata& frameMeta = processedBatch[b].metadata;
+        const size_t imgW = frameMeta.isLetterboxed ? frameMeta.inputWidth : frameMeta.originalWidth;
+        const size_t imgH = frameMeta.isLetterboxed ? frameMeta.inputHeight : frameMeta.originalHeight;
 
         candBoxes.reserve(nBoxes);
         candScores.reserve(nBoxes);
@@ -99,7 +102,7 @@ void YoloSegCpuPostProcessorSimple::process(
             const double x2 = currBoxData[2];
             const double y2 = currBoxData[3];
 
-            if ( !validateBox(x1, x2, y1, y2, static_cast<double>(origImgW), static_cast<double>(origImgH)) ){
+            if ( !validateBox(x1, x2, y1, y2, static_cast<double>(imgW), static_cast<double>(imgH)) ){
                 continue;
             }
 
@@ -116,8 +119,10 @@ void YoloSegCpuPostProcessorSimple::process(
         }
         
 
+        m_candidates.increment(candBoxes.size());
+
         if (candBoxes.empty()) {
-            logger.logConcatMessage(Severity::kINFO, "No detections above threshold for batch item ", b, "\n");
+            YOLO_LOG_EVERY_MS(logger, Severity::kINFO, 1000, "No detections above threshold for batch item ", b, "\n");
             continue;
         }
 
@@ -139,10 +144,10 @@ void YoloSegCpuPostProcessorSimple::process(
         processedBatch[b].detections.reserve(nmsIndices.size());
 
         if (nmsIndices.empty()) {
-            logger.logConcatMessage(Severity::kINFO, "No detections passed the NMS for batch item ", b, "\n");
+            YOLO_LOG_EVERY_MS(logger, Severity::kINFO, 1000, "No detections passed the NMS for batch item ", b, "\n");
             continue;
         }
-        logger.logConcatMessage(Severity::kINFO, "Number of Detections: ", nmsIndices.size(), '\n');
+        YOLO_LOG_EVERY_MS(logger, Severity::kINFO, 1000, "Number of Detections: ", nmsIndices.size(), '\n');
 
         
         for (int k : nmsIndices) {
@@ -159,15 +164,16 @@ void YoloSegCpuPostProcessorSimple::process(
 
             float *currMaskData = const_cast<float*>(maskData + idx4(b, objIdx, 0, 0, nBoxes, maskH, maskW));
             cv::Mat instMask(maskH, maskW, CV_32F, currMaskData);
-            cv::Mat detMask8 = getRoIMaskFromRaw(instMask, boundingBox, origImgW, origImgH, m_maskThresh);
+            cv::Mat detMask8 = getRoIMaskFromRaw(instMask, boundingBox, imgW, imgH, m_maskThresh);
             Detection det;
 
             det.metadata.detectionId = detId;
             det.metadata.imgPath = processedBatch[b].metadata.imagePath;
             getDetections(detMask8, boundingBox, label, objScore, det);
+            unletterboxDetectionInPlace(det, frameMeta);
 
             if (det.objectContour.empty()) {
-                logger.logConcatMessage(Severity::kINFO, "Couldn't get mask contour for frame: ", processedBatch[b].metadata.frameId, '\n');
+                YOLO_LOG_EVERY_MS(logger, Severity::kINFO, 1000, "Couldn't get mask contour for frame: ", processedBatch[b].metadata.frameId, '\n');
             }
 
             processedBatch[b].detections.push_back(std::move(det));
@@ -176,4 +182,10 @@ void YoloSegCpuPostProcessorSimple::process(
         }
         
     }
+
+    for (size_t b = 0; b < batchSize; ++b) {
+        if (!processedBatch[b].metadata.isPadding) {
+            m_detectionsPerFrame.observe(static_cast<double>(processedBatch[b].detections.size()));
+        }
+    }
 }
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <numeric>
 
 #include "post_process/utils/PostProcessUtils.hpp"
@@ -127,6 +128,36 @@ bool normalizeDetectionInPlace(Detection& detection, size_t imageW, size_t image
 }
 
 
+bool unletterboxDetectionInPlace(Detection& detection, const FrameMetadata& metadata) {
+
+    if (!metadata.isLetterboxed || !detection.isNormalized) {
+        return false;
+    }
+
+    const double inputW = static_cast<double>(metadata.inputWidth);
+    const double inputH = static_cast<double>(metadata.inputHeight);
+    const double padX = static_cast<double>(metadata.letterboxPadX);
+    const double padY = static_cast<double>(metadata.letterboxPadY);
+    const double contentW = static_cast<double>(metadata.letterboxWidth);
+    const double contentH = static_cast<double>(metadata.letterboxHeight);
+
+    const auto mapX = [&](double x) { return std::clamp((x * inputW - padX) / contentW, 0.0, 1.0); };
+    const auto mapY = [&](double y) { return std::clamp((y * inputH - padY) / contentH, 0.0, 1.0); };
+
+    cv::Rect2d& box = detection.boundingBox;
+    const double x1 = mapX(box.x);
+    const double y1 = mapY(box.y);
+    box = cv::Rect2d(x1, y1, mapX(box.x + box.width) - x1, mapY(box.y + box.height) - y1);
+
+    for (cv::Point2d& point : detection.objectContour) {
+        point.x = mapX(point.x);
+        point.y = mapY(point.y);
+    }
+
+    return true;
+}
+
+
 bool denormalizeDetection(const Detection& inputDetection, Detection& resultDetection, size_t imageW, size_t imageH) {
     
     if (!inputDetection.isNormalized) {
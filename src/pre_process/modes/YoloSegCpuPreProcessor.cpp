@@ -5,11 +5,16 @@
 
 YoloSegCpuPreProcessor::YoloSegCpuPreProcessor(const PreProcessorConfig& config):
     m_scale(config.imgScalingFactor),
-    m_mean(config.imgMean),
+    // cv::Scalar(imgMean) only fills the first channel; kept so outputs match earlier releases.
+    m_channelMeans{static_cast<float>(config.imgMean), 0.0f, 0.0f},
     m_isBGR(config.imgRgbOrdering == ChannelOrderType::BGR),
     m_outImgH(config.imgResizeHeight),
     m_outImgW(config.imgResizeWidth),
-    m_dtype(config.outputDataType) {
+    m_resizeMode(config.resizeMode),
+    m_letterboxPadValue(static_cast<float>(config.letterboxPadValue)),
+    m_dtype(config.outputDataType),
+    m_layout(config.tensorLayout),
+    m_quantization{config.quantScale, config.quantZeroPoint} {
 
         if (std::find(
             YoloSegCpuPreProcessorSettings::supportedTypes.begin(),
@@ -24,10 +29,33 @@ YoloSegCpuPreProcessor::YoloSegCpuPreProcessor(const PreProcessorConfig& config)
         }
 
         m_nBatchDims = inputDims->second;
+
+        if (!config.imgChannelMeans.empty()) {
+            if (config.imgChannelMeans.size() != m_channelMeans.size()) {
+                throw std::runtime_error("imgChannelMeans needs one value per output channel");
+            }
+            std::copy(config.imgChannelMeans.begin(), config.imgChannelMeans.end(), m_channelMeans.begin());
+        }
+
+        if (m_dtype == DataType::UInt8 &&
+            (m_scale != 1.0f || m_channelMeans != std::array<float, 3>{0.0f, 0.0f, 0.0f})) {
+            throw std::runtime_error("UInt8 preprocessing leaves normalization to the model; use a scaling factor of 1 and zero means");
+        }
+        if (m_dtype == DataType::Int8 &&
+            (!(m_quantization.scale > 0.0f) || m_quantization.zeroPoint < -128 || m_quantization.zeroPoint > 127)) {
+            throw std::runtime_error("Int8 preprocessing needs a positive quantization scale and a zero point in [-128, 127]");
+        }
+        if (m_layout == TensorLayoutType::NHWC && m_dtype != DataType::UInt8) {
+            throw std::runtime_error("NHWC input layout is only supported for UInt8 preprocessing");
+        }
+
+        if (config.imageThreads > 0) {
+            m_imagePool = std::make_unique<ThreadPool>(config.imageThreads);
+        }
 }
 
 void YoloSegCpuPreProcessor::process(
-    const BatchFrameData& inputData,
+    BatchFrameData& inputData,
     TensorViewMap& resultBufferViews
 ) {
 
@@ -40,19 +68,94 @@ void YoloSegCpuPreProcessor::process(
         throw std::runtime_error("Unsupported device for input preprocessing.");
     }
 
+    const size_t channelDim = m_layout == TensorLayoutType::NHWC ? 3 : 1;
+    if (imageTensor.shape.rank() == 4 && imageTensor.shape[channelDim] != StaticSettings::NUM_IMG_CHANNELS) {
+        throw std::runtime_error("Input tensor shape does not match the configured imgTensorLayout.");
+    }
+
+    std::vector<Letterbox> letterboxes;
+    if (m_resizeMode == ResizeModeType::LETTERBOX) {
+        letterboxes.reserve(inputData.images.size());
+        for (size_t i = 0; i < inputData.images.size(); ++i) {
+            const cv::Mat& image = inputData.images[i];
+            const Letterbox& letterbox = letterboxes.emplace_back(computeLetterbox(
+                image.cols, image.rows, static_cast<int>(m_outImgW), static_cast<int>(m_outImgH)
+            ));
+
+            if (i < inputData.metas.size()) {
+                FrameMetadata& metadata = inputData.metas[i];
+                metadata.isLetterboxed = true;
+                metadata.letterboxScale = letterbox.scale;
+                metadata.letterboxPadX = static_cast<size_t>(letterbox.x);
+                metadata.letterboxPadY = static_cast<size_t>(letterbox.y);
+                metadata.letterboxWidth = static_cast<size_t>(letterbox.width);
+                metadata.letterboxHeight = static_cast<size_t>(letterbox.height);
+            }
+        }
+    }
+
     cv::Mat processedBatch;
 
-    if (m_dtype == DataType::Float16) {
+    if (m_layout == TensorLayoutType::NHWC) {
+        processedBatch = createInterleavedBlob4D(
+            inputData.images,
+            batchSize,
+            m_outImgH,
+            m_outImgW,
+            m_isBGR,
+            letterboxes,
+            cv::saturate_cast<uint8_t>(m_letterboxPadValue),
+            imageTensor,
+            m_imagePool.get()
+        );
+
+    } else if (m_dtype == DataType::UInt8) {
+        processedBatch = createBlob4D<uint8_t>(
+            inputData.images,
+            batchSize,
+            StaticSettings::NUM_IMG_CHANNELS,
+            m_outImgH,
+            m_outImgW,
+            m_channelMeans,
+            m_scale,
+            m_isBGR,
+            letterboxes,
+            m_letterboxPadValue,
+            imageTensor,
+            m_imagePool.get()
+        );
+
+    } else if (m_dtype == DataType::Int8) {
+        processedBatch = createBlob4D<int8_t>(
+            inputData.images,
+            batchSize,
+            StaticSettings::NUM_IMG_CHANNELS,
+            m_outImgH,
+            m_outImgW,
+            m_channelMeans,
+            m_scale,
+            m_isBGR,
+            letterboxes,
+            m_letterboxPadValue,
+            imageTensor,
+            m_imagePool.get(),
+            m_quantization
+        );
+
+    } else if (m_dtype == DataType::Float16) {
         processedBatch = createBlob4D<cv::float16_t>(
             inputData.images,
             batchSize,
             StaticSettings::NUM_IMG_CHANNELS,
             m_outImgH,
             m_outImgW,
-            m_mean,
+            m_channelMeans,
             m_scale,
             m_isBGR,
-            imageTensor
+            letterboxes,
+            m_letterboxPadValue,
+            imageTensor,
+            m_imagePool.get()
         );
 
     } else {
@@ -62,10 +165,13 @@ void YoloSegCpuPreProcessor::process(
             StaticSettings::NUM_IMG_CHANNELS,
             m_outImgH,
             m_outImgW,
-            m_mean,
+            m_channelMeans,
             m_scale,
             m_isBGR,
-            imageTensor
+            letterboxes,
+            m_letterboxPadValue,
+            imageTensor,
+            m_imagePool.get()
         );
 
     }
@@ -0,0 +1,518 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "core/tensor.hpp"
+#include "pre_process/utils/PreProcessUtils.hpp"
+
+#ifndef YOLO_ENABLE_AVX2
+    #define YOLO_ENABLE_AVX2 0
+#endif
+
+#if YOLO_ENABLE_AVX2
+    #include <immintrin.h>
+#endif
+
+namespace {
+
+template <typename T>
+inline T toOutput(float value, const Quantization& quantization);
+
+template <>
+inline float toOutput<float>(float value, const Quantization&) {
+    return value;
+}
+
+template <>
+inline cv::float16_t toOutput<cv::float16_t>(float value, const Quantization&) {
+    return cv::float16_t(value);
+}
+
+template <>
+inline uint8_t toOutput<uint8_t>(float value, const Quantization&) {
+    return cv::saturate_cast<uint8_t>(value);
+}
+
+template <>
+inline int8_t toOutput<int8_t>(float value, const Quantization& quantization) {
+    // Clamped as a float, so huge levels from a tiny scale cannot overflow the conversion.
+    const float level = std::nearbyint(value / quantization.scale) + static_cast<float>(quantization.zeroPoint);
+    return static_cast<int8_t>(std::clamp(level, -128.0f, 127.0f));
+}
+
+/**
+ * @brief Scalar conversion of pixels [begin, width) of one BGR row into three output rows.
+ */
+template <typename T>
+void convertRowScalar(
+    const uchar* src,
+    size_t begin,
+    size_t width,
+    const int srcChannel[3],
+    const float mean[3],
+    float scale,
+    const Quantization& quantization,
+    T* const dst[3]
+) {
+    for (size_t x = begin; x < width; ++x) {
+        const uchar* pixel = src + 3 * x;
+        for (int c = 0; c < 3; ++c) {
+            // 8-bit output leaves normalization to the model, so pixels are only reordered.
+            if constexpr (std::is_same_v<T, uint8_t>) {
+                dst[c][x] = pixel[srcChannel[c]];
+            } else {
+                dst[c][x] = toOutput<T>((static_cast<float>(pixel[srcChannel[c]]) - mean[c]) * scale, quantization);
+            }
+        }
+    }
+}
+
+#if YOLO_ENABLE_AVX2
+
+/**
+ * @brief pshufb masks gathering channel k of 16 interleaved BGR pixels from each of three 16-byte loads.
+ *
+ * Byte 3 * j + k of the 48 loaded bytes is pixel j's channel k; it lies in load (3 * j + k) / 16.
+ */
+struct DeinterleaveMasks {
+    alignas(16) int8_t bytes[3][3][16];
+};
+
+constexpr DeinterleaveMasks makeDeinterleaveMasks() {
+    DeinterleaveMasks masks{};
+    for (int k = 0; k < 3; ++k) {
+        for (int load = 0; load < 3; ++load) {
+            for (int j = 0; j < 16; ++j) {
+                const int byte = 3 * j + k;
+                masks.bytes[k][load][j] = byte / 16 == load ? static_cast<int8_t>(byte % 16) : int8_t{-128};
+            }
+        }
+    }
+    return masks;
+}
+
+constexpr DeinterleaveMasks DEINTERLEAVE_MASKS = makeDeinterleaveMasks();
+
+bool cpuSupportsAvx2F16c() {
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+    return supported;
+}
+
+std::atomic<bool> avx2Enabled{true};
+
+bool useAvx2() {
+    return avx2Enabled.load(std::memory_order_relaxed) && cpuSupportsAvx2F16c();
+}
+
+__attribute__((target("avx2,f16c")))
+inline void storeOutput(float* dst, __m256 values) {
+    _mm256_storeu_ps(dst, values);
+}
+
+__attribute__((target("avx2,f16c")))
+inline void storeOutput(cv::float16_t* dst, __m256 values) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+}
+
+/**
+ * @brief Quantization levels of 8 values as int32, already clamped to the INT8 range.
+ */
+__attribute__((target("avx2,f16c")))
+inline __m256i quantizeAvx2(__m256 values, __m256 quantScale, __m256 zeroPoint) {
+    const __m256 rounded = _mm256_round_ps(
+        _mm256_div_ps(values, quantScale), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+    );
+    const __m256 level = _mm256_min_ps(
+        _mm256_max_ps(_mm256_add_ps(rounded, zeroPoint), _mm256_set1_ps(-128.0f)),
+        _mm256_set1_ps(127.0f)
+    );
+    return _mm256_cvtps_epi32(level);
+}
+
+/**
+ * @brief Stores 16 quantization levels, pixels 0-7 in `low` and 8-15 in `high`, as INT8.
+ */
+__attribute__((target("avx2,f16c")))
+inline void storeQuantized(int8_t* dst, __m256i low, __m256i high) {
+    // packs works per 128-bit lane; the permute restores pixel order before narrowing to bytes.
+    const __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8);
+    const __m128i bytes = _mm_packs_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+}
+
+/**
+ * @brief AVX2 conversion of one row in blocks of 16 pixels.
+ * @return Number of pixels converted; the scalar loop finishes the rest.
+ */
+template <typename T>
+__attribute__((target("avx2,f16c")))
+size_t convertRowAvx2(
+    const uchar* src,
+    size_t width,
+    const int srcChannel[3],
+    const float mean[3],
+    float scale,
+    const Quantization& quantization,
+    T* const dst[3]
+) {
+
+    __m128i masks[3][3];
+    __m256 means[3];
+    for (int c = 0; c < 3; ++c) {
+        for (int load = 0; load < 3; ++load) {
+            masks[c][load] = _mm_load_si128(
+                reinterpret_cast<const __m128i*>(DEINTERLEAVE_MASKS.bytes[srcChannel[c]][load])
+            );
+        }
+        means[c] = _mm256_set1_ps(mean[c]);
+    }
+    const __m256 scales = _mm256_set1_ps(scale);
+    const __m256 quantScale = _mm256_set1_ps(quantization.scale);
+    const __m256 zeroPoint = _mm256_set1_ps(static_cast<float>(quantization.zeroPoint));
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const uchar* pixels = src + 3 * x;
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 16));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 32));
+
+        for (int c = 0; c < 3; ++c) {
+            const __m128i channel = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(a, masks[c][0]), _mm_shuffle_epi8(b, masks[c][1])),
+                _mm_shuffle_epi8(d, masks[c][2])
+            );
+
+            if constexpr (std::is_same_v<T, uint8_t>) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst[c] + x), channel);
+            } else {
+                // Same operation order as OpenCV: subtract, then multiply, both in FP32.
+                const __m256 low = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(channel));
+                const __m256 high = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(channel, 8)));
+                const __m256 lowValues = _mm256_mul_ps(_mm256_sub_ps(low, means[c]), scales);
+                const __m256 highValues = _mm256_mul_ps(_mm256_sub_ps(high, means[c]), scales);
+
+                if constexpr (std::is_same_v<T, int8_t>) {
+                    storeQuantized(
+                        dst[c] + x,
+                        quantizeAvx2(lowValues, quantScale, zeroPoint),
+                        quantizeAvx2(highValues, quantScale, zeroPoint)
+                    );
+                } else {
+                    storeOutput(dst[c] + x, lowValues);
+                    storeOutput(dst[c] + x + 8, highValues);
+                }
+            }
+        }
+    }
+    return x;
+}
+
+/**
+ * @brief Copies interleaved pixels with B and R swapped, five pixels per 16-byte load.
+ *
+ * Byte 15 of each load is passed through and then overwritten by the next
+ * block, which starts at byte 15.
+ * @return Number of bytes copied; the scalar loop finishes the rest.
+ */
+__attribute__((target("avx2,f16c")))
+size_t swapRowRBAvx2(const uchar* src, uchar* dst, size_t bytes) {
+
+    const __m128i mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 15) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(pixels, mask));
+    }
+    return i;
+}
+
+#endif
+
+/**
+ * @brief Placement of an image in `width x height` planes; the whole planes without a letterbox.
+ */
+Letterbox placementIn(const Letterbox* letterbox, int height, int width) {
+
+    const Letterbox placement = letterbox ? *letterbox : Letterbox{1.0, 0, 0, width, height};
+    if (
+        placement.x < 0 || placement.y < 0 || placement.width <= 0 || placement.height <= 0 ||
+        placement.x + placement.width > width || placement.y + placement.height > height
+    ) {
+        throw std::runtime_error("Letterbox placement does not fit the output planes.");
+    }
+    return placement;
+}
+
+/**
+ * @brief The image at the placement size, resized into a reused per-thread buffer if needed.
+ *
+ * blobFromImages resizes the 8-bit image before converting it, so the
+ * resized pixels, and hence the outputs, are identical.
+ */
+const cv::Mat& resizeToPlacement(const cv::Mat& image, const Letterbox& placement) {
+
+    if (image.type() != CV_8UC3) {
+        throw std::runtime_error("Blob creation expects CV_8UC3 images.");
+    }
+    if (image.rows == placement.height && image.cols == placement.width) {
+        return image;
+    }
+
+    thread_local cv::Mat resized;
+    cv::resize(image, resized, cv::Size(placement.width, placement.height), 0, 0, cv::INTER_LINEAR);
+    return resized;
+}
+
+template <typename T>
+void fillBlobImageImpl(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    const Quantization& quantization,
+    T* dst
+) {
+
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        // As for blobFromImages with CV_8U: the model normalizes.
+        if (scale != 1.0f || channelMeans != std::array<float, 3>{0.0f, 0.0f, 0.0f}) {
+            throw std::runtime_error("8-bit blobs support neither mean subtraction nor scaling.");
+        }
+    }
+
+    const Letterbox placement = placementIn(letterbox, height, width);
+    const cv::Mat& source = resizeToPlacement(image, placement);
+
+    const int srcChannel[3] = {swapRB ? 2 : 0, 1, swapRB ? 0 : 2};
+    const size_t rowWidth = static_cast<size_t>(width);
+    const size_t planeSize = static_cast<size_t>(height) * rowWidth;
+    const size_t contentWidth = static_cast<size_t>(placement.width);
+    const size_t padLeft = static_cast<size_t>(placement.x);
+    const size_t padRight = rowWidth - padLeft - contentWidth;
+
+    T border[3];
+    for (int c = 0; c < 3; ++c) {
+        border[c] = toOutput<T>((padValue - channelMeans[c]) * scale, quantization);
+    }
+
+    for (int y = 0; y < height; ++y) {
+        T* const rowDst[3] = {
+            dst + y * rowWidth,
+            dst + planeSize + y * rowWidth,
+            dst + 2 * planeSize + y * rowWidth
+        };
+
+        if (y < placement.y || y >= placement.y + placement.height) {
+            for (int c = 0; c < 3; ++c) {
+                std::fill_n(rowDst[c], rowWidth, border[c]);
+            }
+            continue;
+        }
+
+        const uchar* row = source.ptr<uchar>(y - placement.y);
+        T* const contentDst[3] = {rowDst[0] + padLeft, rowDst[1] + padLeft, rowDst[2] + padLeft};
+        for (int c = 0; c < 3; ++c) {
+            std::fill_n(rowDst[c], padLeft, border[c]);
+            std::fill_n(contentDst[c] + contentWidth, padRight, border[c]);
+        }
+
+        size_t x = 0;
+#if YOLO_ENABLE_AVX2
+        if (useAvx2()) {
+            x = convertRowAvx2(row, contentWidth, srcChannel, channelMeans.data(), scale, quantization, contentDst);
+        }
+#endif
+        convertRowScalar(row, x, contentWidth, srcChannel, channelMeans.data(), scale, quantization, contentDst);
+    }
+}
+
+} // namespace
+
+
+void setPreProcessAvx2Enabled(bool enabled) {
+#if YOLO_ENABLE_AVX2
+    avx2Enabled.store(enabled, std::memory_order_relaxed);
+#else
+    (void)enabled;
+#endif
+}
+
+bool preProcessAvx2Active() {
+#if YOLO_ENABLE_AVX2
+    return useAvx2();
+#else
+    return false;
+#endif
+}
+
+Letterbox computeLetterbox(int srcWidth, int srcHeight, int width, int height) {
+
+    if (srcWidth <= 0 || srcHeight <= 0 || width <= 0 || height <= 0) {
+        throw std::runtime_error("Letterbox needs non-empty source and output sizes.");
+    }
+
+    Letterbox letterbox;
+    letterbox.scale = std::min(
+        static_cast<double>(width) / srcWidth,
+        static_cast<double>(height) / srcHeight
+    );
+    letterbox.width = std::clamp(static_cast<int>(std::lrint(srcWidth * letterbox.scale)), 1, width);
+    letterbox.height = std::clamp(static_cast<int>(std::lrint(srcHeight * letterbox.scale)), 1, height);
+    letterbox.x = (width - letterbox.width) / 2;
+    letterbox.y = (height - letterbox.height) / 2;
+    return letterbox;
+}
+
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    float* dst
+) {
+    fillBlobImageImpl(image, height, width, letterbox, padValue, channelMeans, scale, swapRB, Quantization{}, dst);
+}
+
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    cv::float16_t* dst
+) {
+    fillBlobImageImpl(image, height, width, letterbox, padValue, channelMeans, scale, swapRB, Quantization{}, dst);
+}
+
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    uint8_t* dst
+) {
+    fillBlobImageImpl(image, height, width, letterbox, padValue, channelMeans, scale, swapRB, Quantization{}, dst);
+}
+
+void fillBlobImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    float padValue,
+    const std::array<float, 3>& channelMeans,
+    float scale,
+    bool swapRB,
+    const Quantization& quantization,
+    int8_t* dst
+) {
+
+    if (!(quantization.scale > 0.0f) || quantization.zeroPoint < -128 || quantization.zeroPoint > 127) {
+        throw std::runtime_error("INT8 quantization needs a positive scale and a zero point in [-128, 127].");
+    }
+    fillBlobImageImpl(image, height, width, letterbox, padValue, channelMeans, scale, swapRB, quantization, dst);
+}
+
+void fillInterleavedImage(
+    const cv::Mat& image,
+    int height,
+    int width,
+    const Letterbox* letterbox,
+    uint8_t padValue,
+    bool swapRB,
+    uint8_t* dst
+) {
+
+    const Letterbox placement = placementIn(letterbox, height, width);
+    const cv::Mat& source = resizeToPlacement(image, placement);
+
+    const size_t rowBytes = 3 * static_cast<size_t>(width);
+    const size_t contentBytes = 3 * static_cast<size_t>(placement.width);
+    const size_t padLeftBytes = 3 * static_cast<size_t>(placement.x);
+
+    for (int y = 0; y < height; ++y) {
+        uint8_t* rowDst = dst + y * rowBytes;
+
+        if (y < placement.y || y >= placement.y + placement.height) {
+            std::fill_n(rowDst, rowBytes, padValue);
+            continue;
+        }
+
+        std::fill_n(rowDst, padLeftBytes, padValue);
+        std::fill_n(rowDst + padLeftBytes + contentBytes, rowBytes - padLeftBytes - contentBytes, padValue);
+
+        const uchar* row = source.ptr<uchar>(y - placement.y);
+        uint8_t* contentDst = rowDst + padLeftBytes;
+        if (!swapRB) {
+            std::copy_n(row, contentBytes, contentDst);
+            continue;
+        }
+
+        size_t i = 0;
+#if YOLO_ENABLE_AVX2
+        if (useAvx2()) {
+            i = swapRowRBAvx2(row, contentDst, contentBytes);
+        }
+#endif
+        for (; i < contentBytes; i += 3) {
+            contentDst[i] = row[i + 2];
+            contentDst[i + 1] = row[i + 1];
+            contentDst[i + 2] = row[i];
+        }
+    }
+}
+
+cv::Mat createInterleavedBlob4D(
+    const std::vector<cv::Mat>& inputImages,
+    int batchSize,
+    int height,
+    int width,
+    bool swapRB,
+    const std::vector<Letterbox>& letterboxes,
+    uint8_t padValue,
+    TensorView& resultTensor,
+    ThreadPool* imagePool
+) {
+
+    uint8_t* batchData = resultTensor.ptr<uint8_t>();
+
+    if (!batchData) {
+        throw std::runtime_error("Uninitialized Memory for input to the model.");
+    }
+    if (inputImages.size() > static_cast<size_t>(batchSize)) {
+        throw std::runtime_error("More input images than the batch holds.");
+    }
+    if (!letterboxes.empty() && letterboxes.size() != inputImages.size()) {
+        throw std::runtime_error("Letterbox placements do not match the input images.");
+    }
+
+    const size_t imageBytes = 3 * static_cast<size_t>(height) * width;
+    forEachBatchImage(inputImages.size(), imagePool, [&](size_t i) {
+        fillInterleavedImage(
+            inputImages[i], height, width, letterboxes.empty() ? nullptr : &letterboxes[i], padValue,
+            swapRB, batchData + i * imageBytes
+        );
+    });
+
+    int dims[] = {batchSize, height, width, 3};
+    return cv::Mat(4, dims, CV_8U, batchData);
+}
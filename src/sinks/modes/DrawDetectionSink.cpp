@@ -4,6 +4,7 @@
 #include "core/cuda.hpp"
 #include "post_process/utils/MatUtils.hpp"
 #include "sinks/utils/drawUtils.hpp"
+#include "logging/LogMacros.hpp"
 
 
 // CONSTRUCTOR
@@ -90,7 +91,14 @@ void DrawDetectionSink::consumeSingle(PostProcessOutput& output, BaseLogger& log
     size_t imageW = output.metadata.inputWidth;
     size_t imageH = output.metadata.inputHeight;
 
-    cv::resize(cv::imread(output.metadata.imagePath, cv::IMREAD_COLOR), resizedImg, cv::Size(imageW, imageH));
+    // Letterboxed detections are normalized to the frame itself, so draw on it undistorted.
+    if (output.metadata.isLetterboxed) {
+        resizedImg = cv::imread(output.metadata.imagePath, cv::IMREAD_COLOR);
+        imageW = static_cast<size_t>(resizedImg.cols);
+        imageH = static_cast<size_t>(resizedImg.rows);
+    } else {
+        cv::resize(cv::imread(output.metadata.imagePath, cv::IMREAD_COLOR), resizedImg, cv::Size(imageW, imageH));
+    }
     std::string dirName = output.metadata.saveMaskDirName;
 
 
@@ -103,8 +111,11 @@ void DrawDetectionSink::consumeSingle(PostProcessOutput& output, BaseLogger& log
     fs::create_directories(saveDir);
     size_t idx = 0;
 
-    logger.logConcatMessage(LoggingSeverityType::INFO, "Drawing Detections for frame: ", output.metadata.frameId, '\n');
-    logger.logConcatMessage(LoggingSeverityType::INFO, "Total Detections: ", output.detections.size(), '\n');
+    YOLO_LOG_EVERY_MS(
+        logger, LoggingSeverityType::INFO, 1000,
+        "Drawing Detections for frame: ", output.metadata.frameId,
+        ", Total Detections: ", output.detections.size(), '\n'
+    );
 
     for (const auto& sourceDetection : output.detections ) {
         Detection detection = sourceDetection;
@@ -126,6 +137,9 @@ void DrawDetectionSink::consumeSingle(PostProcessOutput& output, BaseLogger& log
     }
 
     const fs::path savePath = saveDir / (output.metadata.imagePath.stem().string() + "_drawn_detections.png");
-    cv::imwrite(savePath.string(), resizedImg);
+    if (cv::imwrite(savePath.string(), resizedImg)) {
+        m_filesWritten.increment();
+        m_bytesWritten.increment(fs::file_size(savePath));
+    }
 
 }
@@ -1,6 +1,7 @@
 #include "sinks/modes/FileDetectionSink.hpp"
 
 #include <fstream>
+#include <string>
 
 // CONSTRUCTOR
 FileDetectionSink::FileDetectionSink(bool saveNormalized) {
@@ -30,8 +31,9 @@ void FileDetectionSink::consumeSingle(PostProcessOutput& output, BaseLogger& log
 
     if ( savePath.empty() ) {
         
-        if ( output.metadata.imagePath.empty() || !std::filesystem::is_regular_file(output.metadata.imagePath) ) {
-            throw std::runtime_error("Image Path not found: " + output.metadata.imagePath.string());
+        // Only the name is used; video and packed frames have no file of their own.
+        if ( output.metadata.imagePath.empty() ) {
+            throw std::runtime_error("Image Path not set for frame " + std::to_string(output.metadata.frameId));
         }
 
         if ( output.metadata.resultsDir.empty() || !std::filesystem::is_directory(output.metadata.resultsDir) ) {
@@ -49,5 +51,8 @@ void FileDetectionSink::consumeSingle(PostProcessOutput& output, BaseLogger& log
     }
     detFile.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
     detFile.close();
+
+    m_filesWritten.increment();
+    m_bytesWritten.increment(bytes.size());
     NVTX_POP();
 }
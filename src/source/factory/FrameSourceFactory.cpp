@@ -10,6 +10,18 @@ std::unique_ptr<FrameSource> createFrameSource(const FrameSourceConfig& config)
         case FrameSourceType::VIDEO:
             return std::make_unique<VideoFrameSource>(config);
 
+        case FrameSourceType::MANIFEST:
+            return std::make_unique<ManifestFrameSource>(config);
+
+        case FrameSourceType::RAW_PACKED:
+            return std::make_unique<RawPackedFrameSource>(config);
+
+        case FrameSourceType::SYNTHETIC:
+            return std::make_unique<SyntheticFrameSource>(config);
+
+        case FrameSourceType::SHARED_MEMORY:
+            return std::make_unique<SharedMemoryFrameSource>(config);
+
         case FrameSourceType::UNSET:
             throw std::runtime_error("Unsupported source format");
 
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include "source/interface/ImageFileFrameSource.hpp"
+#include "AppSettings.hpp"
+
+namespace {
+
+/**
+ * @brief Largest reduced-decode factor whose output still covers the target size.
+ *
+ * Reduced JPEG decoding rounds output dimensions up, hence the ceiling division.
+ */
+size_t selectDecodeScale(size_t srcW, size_t srcH, size_t dstW, size_t dstH) {
+
+    for (const size_t scale : {size_t{8}, size_t{4}, size_t{2}}) {
+        const size_t decodedW = (srcW + scale - 1) / scale;
+        const size_t decodedH = (srcH + scale - 1) / scale;
+        if (decodedW >= dstW && decodedH >= dstH) {
+            return scale;
+        }
+    }
+    return 1;
+}
+
+int imreadFlagsForScale(size_t scale) {
+    switch (scale) {
+        case 8: return cv::IMREAD_REDUCED_COLOR_8;
+        case 4: return cv::IMREAD_REDUCED_COLOR_4;
+        case 2: return cv::IMREAD_REDUCED_COLOR_2;
+        default: return cv::IMREAD_COLOR;
+    }
+}
+
+} // namespace
+
+
+ImageFileFrameSource::ImageFileFrameSource(const FrameSourceConfig& config):
+    FrameSource(config.imgHeight, config.imgWidth, config.batchSize, config.framePoolSize),
+    m_sourcePath(config.sourcePath),
+    m_fileReader(config.fileReadMode),
+    m_prefetchFiles(config.prefetchFiles) {
+
+        if (config.reducedDecode && config.decodeTargetWidth > 0 && config.decodeTargetHeight > 0) {
+            m_decodeScale = selectDecodeScale(
+                m_imgWidth, m_imgHeight, config.decodeTargetWidth, config.decodeTargetHeight
+            );
+            m_imreadFlags = imreadFlagsForScale(m_decodeScale);
+        }
+
+        if (config.decodeThreads > 0) {
+            m_readAheadFrames = config.readAheadFrames > 0
+                ? config.readAheadFrames
+                : m_batchSize + 2 * config.decodeThreads;
+            m_decodePool = std::make_unique<ThreadPool>(config.decodeThreads);
+        }
+}
+
+bool ImageFileFrameSource::isSupportedImageFile(const fs::path& path) {
+    const fs::path ext = path.extension();
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg";
+}
+
+std::vector<fs::path> ImageFileFrameSource::listImageFiles(const fs::path& folder) {
+
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(folder)) {
+        if (entry.is_regular_file() && isSupportedImageFile(entry.path())) {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+bool ImageFileFrameSource::hasFiles() {
+    return fillWindow(1);
+}
+
+void ImageFileFrameSource::reset() {
+
+    // Wait for in-flight decodes; their results belong to the old position.
+    for (std::future<cv::Mat>& pending : m_pending) {
+        pending.wait();
+    }
+    m_pending.clear();
+
+    m_window.clear();
+    m_pathsExhausted = false;
+    m_totalFiles = UNKNOWN_FILE_COUNT;
+    rewindFilePaths();
+
+    m_currId = FRAME_START;
+    m_nextPrefetchId = FRAME_START;
+    m_nextHintId = FRAME_START;
+}
+
+bool ImageFileFrameSource::fillWindow(size_t count) {
+
+    while (m_window.size() < count && !m_pathsExhausted) {
+        fs::path path;
+        if (nextFilePath(path)) {
+            m_window.push_back(std::move(path));
+        } else {
+            m_pathsExhausted = true;
+            m_totalFiles = m_currId + m_window.size();
+        }
+    }
+    return m_window.size() >= count;
+}
+
+cv::Mat ImageFileFrameSource::decodeImage(const fs::path& imgPath, int imreadFlags, cv::Mat destination) const {
+
+    EncodedFile encoded;
+    if (!m_fileReader.load(imgPath, encoded)) {
+        return cv::Mat();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // imdecode reuses `destination` when the decoded size and type match it.
+    cv::imdecode(encoded.asMat(), imreadFlags, &destination);
+
+    m_decodeMicros.increment(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+    ));
+    return destination;
+}
+
+void ImageFileFrameSource::hintUpcomingFiles(size_t decodeFrontId) {
+
+    if (m_prefetchFiles == 0) {
+        return;
+    }
+
+    // Files before the decode front are already being read; hint the next m_prefetchFiles after it.
+    const size_t hintEnd = decodeFrontId + m_prefetchFiles;
+    fillWindow(hintEnd - m_currId);
+
+    m_nextHintId = std::max(m_nextHintId, decodeFrontId);
+    while (m_nextHintId < hintEnd && m_nextHintId < m_currId + m_window.size()) {
+        m_fileReader.prefetch(m_window[m_nextHintId - m_currId]);
+        ++m_nextHintId;
+    }
+}
+
+cv::Mat ImageFileFrameSource::acquireDecodeBuffer() {
+    // Reduced decoding rounds each dimension up.
+    return m_framePool.acquire(
+        static_cast<int>((m_imgHeight + m_decodeScale - 1) / m_decodeScale),
+        static_cast<int>((m_imgWidth + m_decodeScale - 1) / m_decodeScale),
+        CV_8UC3
+    );
+}
+
+cv::Mat ImageFileFrameSource::nextDecodedImage() {
+
+    if (!m_decodePool) {
+        hintUpcomingFiles(m_currId + 1);
+        return decodeImage(m_window.front(), m_imreadFlags, acquireDecodeBuffer());
+    }
+
+    // Keep files [m_currId, m_currId + m_readAheadFrames) queued or decoded.
+    // Buffers are acquired here since the pool is only touched by the reading thread.
+    fillWindow(m_readAheadFrames);
+    while (m_nextPrefetchId < m_currId + std::min(m_readAheadFrames, m_window.size())) {
+        const fs::path* imgPath = &m_window[m_nextPrefetchId++ - m_currId];
+        const int imreadFlags = m_imreadFlags;
+        m_pending.push_back(m_decodePool->submit([this, imgPath, imreadFlags, destination = acquireDecodeBuffer()]() {
+            return decodeImage(*imgPath, imreadFlags, destination);
+        }));
+    }
+    hintUpcomingFiles(m_nextPrefetchId);
+
+    cv::Mat image = m_pending.front().get();
+    m_pending.pop_front();
+    return image;
+}
+
+bool ImageFileFrameSource::read(Frame& frame, BaseLogger& logger) {
+
+    if ( !fillWindow(1) ) {
+        const size_t paddedSize = ((m_totalFiles + m_batchSize - 1) / m_batchSize) * m_batchSize;
+        if (m_currId >= paddedSize) {
+            return false;
+        }
+
+        frame.image = zeros();
+        frame.metadata.frameId = m_firstFrameId + m_currId;
+        frame.metadata.sourcePath = m_sourcePath;
+        frame.metadata.imagePath = fs::path("");
+        frame.metadata.timestampNs = INVALID_TIMESTAMP;
+        frame.metadata.originalWidth = m_imgWidth;
+        frame.metadata.originalHeight = m_imgHeight;
+        frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+        frame.metadata.decodedWidth = m_imgWidth;
+        frame.metadata.decodedHeight = m_imgHeight;
+        frame.metadata.decodeScale = 1;
+        frame.metadata.isPadding = true;
+
+        ++m_currId;
+
+        return true;
+    }
+
+    frame.metadata.frameId = m_firstFrameId + m_currId;
+    frame.metadata.sourcePath = m_sourcePath;
+    frame.metadata.timestampNs = INVALID_TIMESTAMP;
+    frame.metadata.originalWidth = m_imgWidth;
+    frame.metadata.originalHeight = m_imgHeight;
+    frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+    frame.metadata.isPadding = false;
+
+    frame.image = nextDecodedImage();
+    frame.metadata.decodeScale = m_decodeScale;
+
+    if (frame.image.empty()) {
+        m_decodeFailures.increment();
+        logger.logConcatMessage(
+            LoggingSeverityType::ERROR,
+            "Could not read image: ",
+            m_window.front().string(),
+            ". Using zeros.\n"
+        );
+        frame.image = zeros();
+        frame.metadata.decodeScale = 1;
+    }
+
+    frame.metadata.decodedWidth = static_cast<size_t>(frame.image.cols);
+    frame.metadata.decodedHeight = static_cast<size_t>(frame.image.rows);
+
+    // The front path's decode has completed, so nothing refers to it any more.
+    frame.metadata.imagePath = std::move(m_window.front());
+    m_window.pop_front();
+    m_currId++;
+
+    return true;
+}
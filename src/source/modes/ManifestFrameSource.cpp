@@ -0,0 +1,108 @@
+#include <system_error>
+
+#include "source/modes/ManifestFrameSource.hpp"
+
+
+ManifestFrameSource::ManifestFrameSource(const FrameSourceConfig& config):
+    ImageFileFrameSource(config),
+    m_startOffset(config.startOffset),
+    m_endOffset(config.endOffset) {
+
+        if (fs::is_directory(m_sourcePath)) {
+            m_walkDirectory = true;
+        } else if (fs::is_regular_file(m_sourcePath)) {
+            m_manifestDir = m_sourcePath.parent_path();
+        } else {
+            throw std::runtime_error("Invalid source path for a manifest : " + m_sourcePath.string());
+        }
+
+        if (m_endOffset > 0 && m_endOffset <= m_startOffset) {
+            throw std::runtime_error(
+                "Manifest endOffset must be greater than startOffset: " +
+                std::to_string(m_endOffset) + " <= " + std::to_string(m_startOffset)
+            );
+        }
+
+        m_firstFrameId = m_startOffset;
+        rewindFilePaths();
+
+        if (!hasFiles()) {
+            throw std::runtime_error("No image files in manifest slice: " + m_sourcePath.string());
+        }
+}
+
+void ManifestFrameSource::rewindFilePaths() {
+
+    if (m_walkDirectory) {
+        m_walk = fs::recursive_directory_iterator(m_sourcePath, fs::directory_options::skip_permission_denied);
+    } else {
+        m_manifest.close();
+        m_manifest.clear();
+        m_manifest.open(m_sourcePath);
+        if (!m_manifest.is_open()) {
+            throw std::runtime_error("Could not open manifest: " + m_sourcePath.string());
+        }
+    }
+
+    // Entries before the slice are parsed but not kept.
+    fs::path skipped;
+    m_nextEntryIdx = 0;
+    while (m_nextEntryIdx < m_startOffset && nextEntry(skipped)) {
+        ++m_nextEntryIdx;
+    }
+}
+
+bool ManifestFrameSource::nextFilePath(fs::path& path) {
+
+    if (m_endOffset > 0 && m_nextEntryIdx >= m_endOffset) {
+        return false;
+    }
+    if (!nextEntry(path)) {
+        return false;
+    }
+    ++m_nextEntryIdx;
+    return true;
+}
+
+bool ManifestFrameSource::nextEntry(fs::path& path) {
+
+    if (m_walkDirectory) {
+        std::error_code ec;
+        while (m_walk != fs::recursive_directory_iterator()) {
+            const bool isImage = m_walk->is_regular_file(ec) && isSupportedImageFile(m_walk->path());
+            if (isImage) {
+                path = m_walk->path();
+            }
+
+            m_walk.increment(ec);
+            if (ec) {
+                throw std::runtime_error("Could not walk " + m_sourcePath.string() + ": " + ec.message());
+            }
+
+            if (isImage) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    while (std::getline(m_manifest, m_line)) {
+
+        const size_t first = m_line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || m_line[first] == '#') {
+            continue;
+        }
+        const size_t last = m_line.find_last_not_of(" \t\r");
+
+        path = m_line.substr(first, last - first + 1);
+        if (path.is_relative()) {
+            path = m_manifestDir / path;
+        }
+        return true;
+    }
+
+    if (m_manifest.bad()) {
+        throw std::runtime_error("Could not read manifest: " + m_sourcePath.string());
+    }
+    return false;
+}
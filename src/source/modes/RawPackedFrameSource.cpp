@@ -0,0 +1,113 @@
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source/modes/RawPackedFrameSource.hpp"
+#include "source/utils/RawPackedFormat.hpp"
+#include "AppSettings.hpp"
+
+
+RawPackedFrameSource::RawPackedFrameSource(const FrameSourceConfig& config):
+    FrameSource(config.imgHeight, config.imgWidth, config.batchSize),
+    m_packedPath(config.sourcePath) {
+
+        const int fd = ::open(m_packedPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open packed file: " + m_packedPath.string());
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(RawPackedHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Packed file is too small: " + m_packedPath.string());
+        }
+
+        m_mappingSize = static_cast<size_t>(info.st_size);
+        m_mapping = ::mmap(nullptr, m_mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            throw std::runtime_error("Could not map packed file: " + m_packedPath.string());
+        }
+
+        // Frames are consumed front to back; start reading them in now.
+        ::madvise(m_mapping, m_mappingSize, MADV_SEQUENTIAL);
+        ::madvise(m_mapping, m_mappingSize, MADV_WILLNEED);
+
+        RawPackedHeader header;
+        std::memcpy(&header, m_mapping, sizeof(header));
+
+        std::string error;
+        if (std::memcmp(header.magic, RAW_PACKED_MAGIC, sizeof(header.magic)) != 0 || header.version != RAW_PACKED_VERSION) {
+            error = "Not a raw packed file (bad magic or version): ";
+        } else if (header.channels != StaticSettings::NUM_IMG_CHANNELS) {
+            error = "Packed file must hold 3-channel frames: ";
+        } else if (header.width != m_imgWidth || header.height != m_imgHeight) {
+            error = "Packed frame size " + std::to_string(header.width) + "x" + std::to_string(header.height) +
+                " differs from origImgWidth x origImgHeight: ";
+        } else {
+            m_frameBytes = m_imgHeight * m_imgWidth * StaticSettings::NUM_IMG_CHANNELS;
+            if (header.dataOffset > m_mappingSize || (m_mappingSize - header.dataOffset) / m_frameBytes < header.frameCount) {
+                error = "Packed file is truncated: ";
+            }
+        }
+
+        if (!error.empty()) {
+            ::munmap(m_mapping, m_mappingSize);
+            m_mapping = nullptr;
+            throw std::runtime_error(error + m_packedPath.string());
+        }
+
+        m_frames = static_cast<const uchar*>(m_mapping) + header.dataOffset;
+        m_frameCount = static_cast<size_t>(header.frameCount);
+}
+
+RawPackedFrameSource::~RawPackedFrameSource() {
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, m_mappingSize);
+    }
+}
+
+bool RawPackedFrameSource::read(Frame& frame, BaseLogger& logger) {
+
+    const size_t paddedSize = ((m_frameCount + m_batchSize - 1) / m_batchSize) * m_batchSize;
+    if (m_currId >= paddedSize) {
+        return false;
+    }
+
+    const bool isPadding = m_currId >= m_frameCount;
+
+    frame.metadata.frameId = m_currId;
+    frame.metadata.sourcePath = m_packedPath;
+    frame.metadata.imagePath = isPadding
+        ? fs::path("")
+        : fs::path(m_packedPath.stem().string() + "_frame_" + std::to_string(m_currId) + ".raw");
+    frame.metadata.timestampNs = INVALID_TIMESTAMP;
+    frame.metadata.originalWidth = m_imgWidth;
+    frame.metadata.originalHeight = m_imgHeight;
+    frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+    frame.metadata.decodedWidth = m_imgWidth;
+    frame.metadata.decodedHeight = m_imgHeight;
+    frame.metadata.decodeScale = 1;
+    frame.metadata.isPadding = isPadding;
+
+    if (isPadding) {
+        frame.image = zeros();
+    } else {
+        // A header over the mapping; the pixels are never copied.
+        frame.image = cv::Mat(
+            static_cast<int>(m_imgHeight),
+            static_cast<int>(m_imgWidth),
+            CV_8UC3,
+            const_cast<uchar*>(m_frames + m_currId * m_frameBytes)
+        );
+    }
+
+    ++m_currId;
+    return true;
+}
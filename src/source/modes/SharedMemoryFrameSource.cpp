@@ -0,0 +1,189 @@
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source/modes/SharedMemoryFrameSource.hpp"
+#include "AppSettings.hpp"
+
+
+SharedMemoryFrameSource::SharedMemoryFrameSource(const FrameSourceConfig& config):
+    FrameSource(config.imgHeight, config.imgWidth, config.batchSize),
+    m_ringName(config.sourcePath),
+    m_timeout(config.sharedMemoryTimeoutMs) {
+
+        const int fd = ::shm_open(m_ringName.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open shared memory " + m_ringName.string() + ": " + std::strerror(errno));
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SharedFrameRingHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Shared memory is too small for a frame ring: " + m_ringName.string());
+        }
+
+        m_mappingSize = static_cast<size_t>(info.st_size);
+        m_mapping = ::mmap(nullptr, m_mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (m_mapping == MAP_FAILED) {
+            m_mapping = nullptr;
+            throw std::runtime_error("Could not map shared memory " + m_ringName.string());
+        }
+
+        m_header = static_cast<SharedFrameRingHeader*>(m_mapping);
+
+        std::string error;
+        if (std::memcmp(m_header->magic, SHARED_FRAME_RING_MAGIC, sizeof(m_header->magic)) != 0 ||
+            m_header->version != SHARED_FRAME_RING_VERSION) {
+            error = "Not a frame ring (bad magic or version): ";
+        } else if (m_header->slotCount < m_batchSize) {
+            error = "Frame ring has " + std::to_string(m_header->slotCount) + " slots, batchSize needs at least " +
+                std::to_string(m_batchSize) + ": ";
+        } else if (m_header->slotsOffset + m_header->slotBytes * m_header->slotCount > m_mappingSize) {
+            error = "Frame ring is larger than its shared memory: ";
+        }
+
+        if (!error.empty()) {
+            ::munmap(m_mapping, m_mappingSize);
+            m_mapping = nullptr;
+            throw std::runtime_error(error + m_ringName.string());
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        m_slots = static_cast<const uchar*>(m_mapping) + m_header->slotsOffset;
+        m_released.assign(m_header->slotCount, false);
+
+        // Resume after whatever a previous consumer released.
+        m_releasedSeq = m_header->readSeq.load(std::memory_order_acquire);
+        m_nextSeq = m_releasedSeq;
+}
+
+SharedMemoryFrameSource::~SharedMemoryFrameSource() {
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, m_mappingSize);
+    }
+}
+
+bool SharedMemoryFrameSource::waitForFrame(BaseLogger& logger) {
+
+    auto idleSince = std::chrono::steady_clock::now();
+
+    while (true) {
+        // Read `closed` first: once it is set, writeSeq already holds the final count.
+        const bool closed = m_header->closed.load(std::memory_order_acquire) != 0;
+        if (m_header->writeSeq.load(std::memory_order_acquire) > m_nextSeq) {
+            return true;
+        }
+        if (closed) {
+            return false;
+        }
+
+        if (m_timeout.count() > 0 && std::chrono::steady_clock::now() - idleSince >= m_timeout) {
+            logger.logConcatMessage(
+                LoggingSeverityType::WARNING,
+                "No frame from ", m_ringName.string(), " for ", m_timeout.count(), " ms. Ending the stream.\n"
+            );
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+bool SharedMemoryFrameSource::read(Frame& frame, BaseLogger& logger) {
+
+    if (!m_ended && !waitForFrame(logger)) {
+        m_ended = true;
+    }
+
+    if (m_ended) {
+        if (m_framesRead % m_batchSize == 0) {
+            return false;
+        }
+
+        frame.image = zeros();
+        frame.metadata.frameId = m_nextPaddingId++;
+        frame.metadata.sourcePath = m_ringName;
+        frame.metadata.imagePath = fs::path("");
+        frame.metadata.timestampNs = INVALID_TIMESTAMP;
+        frame.metadata.originalWidth = m_imgWidth;
+        frame.metadata.originalHeight = m_imgHeight;
+        frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+        frame.metadata.decodedWidth = m_imgWidth;
+        frame.metadata.decodedHeight = m_imgHeight;
+        frame.metadata.decodeScale = 1;
+        frame.metadata.isPadding = true;
+        ++m_framesRead;
+        return true;
+    }
+
+    const uchar* slot = m_slots + (m_nextSeq % m_header->slotCount) * m_header->slotBytes;
+    SharedFrameSlotHeader slotHeader;
+    std::memcpy(&slotHeader, slot, sizeof(slotHeader));
+
+    if (slotHeader.channels != StaticSettings::NUM_IMG_CHANNELS ||
+        slotHeader.stride < size_t{slotHeader.width} * StaticSettings::NUM_IMG_CHANNELS ||
+        SHARED_FRAME_PIXELS_OFFSET + size_t{slotHeader.stride} * slotHeader.height > m_header->slotBytes) {
+        throw std::runtime_error(
+            "Malformed frame in " + m_ringName.string() + " slot sequence " + std::to_string(m_nextSeq)
+        );
+    }
+
+    frame.metadata.frameId = slotHeader.frameId;
+    frame.metadata.sourcePath = m_ringName;
+    frame.metadata.imagePath = fs::path(
+        m_ringName.filename().string() + "_frame_" + std::to_string(slotHeader.frameId) + ".raw"
+    );
+    frame.metadata.timestampNs = slotHeader.timestampNs;
+    frame.metadata.originalWidth = slotHeader.width;
+    frame.metadata.originalHeight = slotHeader.height;
+    frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+    frame.metadata.decodedWidth = slotHeader.width;
+    frame.metadata.decodedHeight = slotHeader.height;
+    frame.metadata.decodeScale = 1;
+    frame.metadata.isPadding = false;
+    frame.metadata.sourceSequence = m_nextSeq;
+
+    // A header over the slot; the pixels stay in shared memory until releaseBatch().
+    frame.image = cv::Mat(
+        static_cast<int>(slotHeader.height),
+        static_cast<int>(slotHeader.width),
+        CV_8UC3,
+        const_cast<uchar*>(slot + SHARED_FRAME_PIXELS_OFFSET),
+        slotHeader.stride
+    );
+
+    m_nextPaddingId = slotHeader.frameId + 1;
+    ++m_nextSeq;
+    ++m_framesRead;
+    return true;
+}
+
+void SharedMemoryFrameSource::releaseBatch(BatchFrameData& batch) {
+
+    std::lock_guard<std::mutex> lock(m_releaseMutex);
+
+    for (size_t i = 0; i < batch.metas.size(); ++i) {
+        if (!batch.metas[i].isPadding) {
+            m_released[batch.metas[i].sourceSequence % m_released.size()] = true;
+        }
+        batch.images[i].release();
+    }
+
+    // Batches may finish preprocessing out of order; hand back only the contiguous prefix.
+    const uint64_t releasedBefore = m_releasedSeq;
+    while (m_released[m_releasedSeq % m_released.size()]) {
+        m_released[m_releasedSeq % m_released.size()] = false;
+        ++m_releasedSeq;
+    }
+
+    if (m_releasedSeq != releasedBefore) {
+        m_header->readSeq.store(m_releasedSeq, std::memory_order_release);
+    }
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include <opencv2/imgproc.hpp>
+
+#include "source/modes/SyntheticFrameSource.hpp"
+#include "AppSettings.hpp"
+
+namespace {
+
+const cv::Scalar SOLID_PALETTE[] = {
+    cv::Scalar(255, 0, 0), cv::Scalar(0, 255, 0), cv::Scalar(0, 0, 255),
+    cv::Scalar(255, 255, 0), cv::Scalar(0, 255, 255), cv::Scalar(255, 0, 255),
+    cv::Scalar(255, 255, 255), cv::Scalar(128, 128, 128),
+};
+
+} // namespace
+
+
+SyntheticFrameSource::SyntheticFrameSource(const FrameSourceConfig& config):
+    FrameSource(config.imgHeight, config.imgWidth, config.batchSize, config.framePoolSize),
+    m_pattern(config.syntheticPattern),
+    m_frameCount(config.syntheticFrameCount),
+    m_fps(config.syntheticFps) {
+
+        if (m_imgHeight == 0 || m_imgWidth == 0) {
+            throw std::runtime_error("Synthetic source needs a non-zero origImgHeight and origImgWidth");
+        }
+        if (m_fps < 0.0) {
+            throw std::runtime_error("Synthetic source fps must not be negative: " + std::to_string(m_fps));
+        }
+}
+
+void SyntheticFrameSource::drawFrame(cv::Mat& image, uint64_t frameId) const {
+
+    switch (m_pattern) {
+
+        case SyntheticPattern::SOLID:
+            image.setTo(SOLID_PALETTE[frameId % (sizeof(SOLID_PALETTE) / sizeof(SOLID_PALETTE[0]))]);
+            break;
+
+        case SyntheticPattern::NOISE: {
+            cv::RNG rng(frameId + 1);
+            rng.fill(image, cv::RNG::UNIFORM, cv::Scalar::all(0), cv::Scalar::all(256));
+            break;
+        }
+
+        case SyntheticPattern::SHAPES:
+        default: {
+            const int width = image.cols;
+            const int height = image.rows;
+            const int side = std::max(1, std::min(width, height) / 4);
+
+            // Both shapes cross the frame in 4 seconds of 30 fps footage, in opposite directions.
+            const int travelX = std::max(1, width - side);
+            const int travelY = std::max(1, height - side);
+            const int step = static_cast<int>(frameId % 120);
+
+            image.setTo(cv::Scalar(114, 114, 114));
+            cv::rectangle(
+                image,
+                cv::Rect(step * travelX / 120, step * travelY / 120, side, side),
+                cv::Scalar(0, 0, 255),
+                cv::FILLED
+            );
+            cv::circle(
+                image,
+                cv::Point(width - side / 2 - step * travelX / 120, side / 2 + step * travelY / 120),
+                side / 2,
+                cv::Scalar(255, 128, 0),
+                cv::FILLED
+            );
+            break;
+        }
+    }
+}
+
+bool SyntheticFrameSource::read(Frame& frame, BaseLogger& logger) {
+
+    if (m_currId == FRAME_START) {
+        m_startTime = std::chrono::steady_clock::now();
+    }
+
+    const bool isPadding = m_frameCount > 0 && m_currId >= m_frameCount;
+    if (isPadding) {
+        const size_t paddedSize = ((m_frameCount + m_batchSize - 1) / m_batchSize) * m_batchSize;
+        if (m_currId >= paddedSize) {
+            return false;
+        }
+    }
+
+    if (m_fps > 0.0 && !isPadding) {
+        std::this_thread::sleep_until(
+            m_startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(static_cast<double>(m_currId) / m_fps)
+            )
+        );
+    }
+
+    frame.metadata.frameId = m_currId;
+    frame.metadata.sourcePath = fs::path("synthetic");
+    frame.metadata.imagePath = isPadding
+        ? fs::path("")
+        : fs::path("synthetic_frame_" + std::to_string(m_currId) + ".png");
+    frame.metadata.timestampNs = m_fps > 0.0
+        ? static_cast<uint64_t>((1e9 * static_cast<double>(m_currId)) / m_fps)
+        : static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_startTime
+        ).count());
+    frame.metadata.originalWidth = m_imgWidth;
+    frame.metadata.originalHeight = m_imgHeight;
+    frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+    frame.metadata.decodedWidth = m_imgWidth;
+    frame.metadata.decodedHeight = m_imgHeight;
+    frame.metadata.decodeScale = 1;
+    frame.metadata.isPadding = isPadding;
+
+    if (isPadding) {
+        frame.image = zeros();
+    } else {
+        frame.image = m_framePool.acquire(static_cast<int>(m_imgHeight), static_cast<int>(m_imgWidth), CV_8UC3);
+        drawFrame(frame.image, m_currId);
+    }
+
+    ++m_currId;
+    return true;
+}
@@ -1,10 +1,13 @@
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <string>
 
 #include "source/modes/VideoFrameSource.hpp"
 #include "AppSettings.hpp"
 
 VideoFrameSource::VideoFrameSource(const FrameSourceConfig& config):
-    FrameSource(config.imgHeight, config.imgWidth, config.batchSize),
+    FrameSource(config.imgHeight, config.imgWidth, config.batchSize, config.framePoolSize),
     m_videoPath(config.sourcePath) {
 
         const std::string videoPathString = m_videoPath.string();
@@ -13,38 +16,216 @@ VideoFrameSource::VideoFrameSource(const FrameSourceConfig& config):
         if (!m_cap.isOpened()) {
             throw std::runtime_error("Video could not be opened.");
         }
+
+        m_fps = m_cap.get(cv::CAP_PROP_FPS);
+        m_totalFrames = static_cast<size_t>(m_cap.get(cv::CAP_PROP_FRAME_COUNT));
+
+        if (config.videoFrameStride == 0) {
+            throw std::runtime_error("videoFrameStride must be at least 1.");
+        }
+        m_frameStride = config.videoFrameStride;
+
+        const bool timeSampling = config.videoTargetFps > 0.0 || config.videoStartMs > 0 || config.videoEndMs > 0;
+        if (timeSampling && !(m_fps > 0.0)) {
+            throw std::runtime_error("Video reports no frame rate, so it cannot be sampled by time: " + videoPathString);
+        }
+        if (config.videoEndMs > 0 && config.videoEndMs <= config.videoStartMs) {
+            throw std::runtime_error("videoEndMs must be greater than videoStartMs.");
+        }
+
+        // Frame i is at i / fps seconds, so [start, end) maps to frames [ceil(start * fps), ceil(end * fps)).
+        m_targetFps = config.videoTargetFps;
+        m_startFrame = static_cast<size_t>(std::ceil(1e-3 * config.videoStartMs * m_fps));
+        m_endFrame = config.videoEndMs > 0
+            ? static_cast<size_t>(std::ceil(1e-3 * config.videoEndMs * m_fps))
+            : std::numeric_limits<size_t>::max();
+
+        if (config.videoDecodeSegments > 1) {
+            m_segmentDecoder = std::make_unique<SegmentedVideoDecoder>(
+                m_videoPath,
+                config.videoDecodeSegments,
+                config.videoSegmentFrames,
+                m_startFrame,
+                m_endFrame,
+                m_totalFrames,
+                m_imgHeight,
+                m_imgWidth,
+                m_framePool.capacity(),
+                [this](size_t frameId) { return keepFrame(frameId); }
+            );
+            m_cap.release();
+        } else if (config.decodeThreads > 0) {
+            m_readAheadFrames = config.readAheadFrames > 0 ? config.readAheadFrames : 2 * m_batchSize;
+            m_decodeThread = std::thread([this]() { decodeLoop(); });
+        }
+}
+
+VideoFrameSource::~VideoFrameSource() {
+
+    if (m_decodeThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_ringMutex);
+            m_stopping = true;
+        }
+        m_slotFree.notify_all();
+        m_decodeThread.join();
+    }
+}
+
+bool VideoFrameSource::keepFrame(size_t frameId) const {
+
+    if (frameId < m_startFrame || (frameId - m_startFrame) % m_frameStride != 0) {
+        return false;
+    }
+    if (m_targetFps <= 0.0) {
+        return true;
+    }
+
+    // Keep the first strided frame of each 1 / m_targetFps interval after the start, i.e. one
+    // whose interval differs from the previous strided frame's. The epsilon keeps exact
+    // multiples, such as 2 FPS from 30 FPS, on their own frame.
+    if (frameId == m_startFrame) {
+        return true;
+    }
+    const auto interval = [this](size_t id) {
+        const double elapsedSeconds = static_cast<double>(id - m_startFrame) / m_fps;
+        return static_cast<size_t>(std::floor(elapsedSeconds * m_targetFps + 1e-6));
+    };
+    return interval(frameId) != interval(frameId - m_frameStride);
+}
+
+bool VideoFrameSource::decodeFrame(DecodedFrame& frame) {
+
+    while (m_streamPos < m_endFrame) {
+        // grab() only demuxes and decodes the packet; the conversion to BGR happens in retrieve().
+        if (!m_cap.grab()) {
+            return false;
+        }
+
+        const size_t frameId = m_streamPos++;
+        if (!keepFrame(frameId)) {
+            m_framesSkipped.increment();
+            continue;
+        }
+
+        // retrieve() converts in place when the buffer already has the frame geometry.
+        frame.image = m_framePool.acquire(static_cast<int>(m_imgHeight), static_cast<int>(m_imgWidth), CV_8UC3);
+        frame.frameId = frameId;
+        return m_cap.retrieve(frame.image);
+    }
+    return false;
+}
+
+void VideoFrameSource::decodeLoop() {
+
+    // Once decode-ahead is on, this thread is the only user of m_cap and m_framePool.
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_ringMutex);
+            m_slotFree.wait(lock, [this]() { return m_stopping || m_decoded.size() < m_readAheadFrames; });
+            if (m_stopping) {
+                return;
+            }
+        }
+
+        DecodedFrame frame;
+        bool decoded = false;
+        std::exception_ptr error;
+        try {
+            decoded = decodeFrame(frame);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_ringMutex);
+            if (decoded) {
+                m_decoded.push_back(std::move(frame));
+            } else {
+                m_decodeEnded = true;
+                m_decodeError = error;
+            }
+        }
+        m_frameReady.notify_one();
+
+        if (!decoded) {
+            return;
+        }
+    }
+}
+
+bool VideoFrameSource::nextDecodedFrame(DecodedFrame& frame) {
+
+    if (m_segmentDecoder) {
+        return m_segmentDecoder->next(frame.image, frame.frameId);
+    }
+    if (!m_decodeThread.joinable()) {
+        return decodeFrame(frame);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(m_ringMutex);
+        m_frameReady.wait(lock, [this]() { return m_decodeEnded || !m_decoded.empty(); });
+
+        if (m_decoded.empty()) {
+            if (m_decodeError) {
+                std::rethrow_exception(m_decodeError);
+            }
+            return false;
+        }
+
+        frame = std::move(m_decoded.front());
+        m_decoded.pop_front();
+    }
+    m_slotFree.notify_one();
+
+    m_readWaitMicros.increment(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+    ));
+    return true;
 }
 
 
 bool VideoFrameSource::read(Frame& frame, BaseLogger& logger) {
 
-    size_t currFrameId = static_cast<uint64_t>(m_cap.get(cv::CAP_PROP_POS_FRAMES));
+    DecodedFrame decoded;
+    if (!m_ended && !nextDecodedFrame(decoded)) {
+        m_ended = true;
+        m_paddedSize = ((m_framesKept + m_batchSize - 1) / m_batchSize) * m_batchSize;
+    }
+
+    if (m_ended && m_framesKept >= m_paddedSize) {
+        return false;
+    }
+    ++m_framesKept;
+
+    // Padding ids continue after the last kept frame.
+    const size_t currFrameId = m_ended ? m_nextPaddingId : decoded.frameId;
+    m_nextPaddingId = currFrameId + 1;
 
     frame.metadata.sourcePath = m_videoPath;
     frame.metadata.imagePath = m_videoPath.stem().string() + ("_frame_" + std::to_string(currFrameId) + ".jpg");
     frame.metadata.frameId = currFrameId;
-    double fps = getFPS();
-    frame.metadata.timestampNs = static_cast<uint64_t>((1e9 * frame.metadata.frameId) / fps);
-    frame.metadata.isPadding = false;
+    frame.metadata.timestampNs = m_fps > 0.0
+        ? static_cast<uint64_t>((1e9 * currFrameId) / m_fps)
+        : INVALID_TIMESTAMP;
     frame.metadata.originalWidth = m_imgWidth;
     frame.metadata.originalHeight = m_imgHeight;
     frame.metadata.originalChannels = StaticSettings::NUM_IMG_CHANNELS;
+    frame.metadata.decodeScale = 1;
 
-    size_t totalFrames = getTotalFrames();
-
-    if ( currFrameId >= totalFrames ) {
-        const size_t paddedSize = ((totalFrames + m_batchSize - 1) / m_batchSize) * m_batchSize;
-        if (m_paddingFrameId == 0) {
-            m_paddingFrameId = currFrameId;
-        }
-        if (m_paddingFrameId >= paddedSize) {
-            return false;
-        }
+    if (m_ended) {
         frame.image = zeros();
-        frame.metadata.frameId = m_paddingFrameId++;
+        frame.metadata.decodedWidth = m_imgWidth;
+        frame.metadata.decodedHeight = m_imgHeight;
         frame.metadata.isPadding = true;
         return true;
     }
 
-    return m_cap.read(frame.image);
+    frame.image = std::move(decoded.image);
+    frame.metadata.decodedWidth = static_cast<size_t>(frame.image.cols);
+    frame.metadata.decodedHeight = static_cast<size_t>(frame.image.rows);
+    frame.metadata.isPadding = false;
+    return true;
 }
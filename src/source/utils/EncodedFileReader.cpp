@@ -0,0 +1,105 @@
+#include <chrono>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source/utils/EncodedFileReader.hpp"
+
+
+EncodedFile::~EncodedFile() {
+    release();
+}
+
+void EncodedFile::release() {
+
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, m_size);
+        m_mapping = nullptr;
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+
+EncodedFileReader::EncodedFileReader(FileReadMode mode):
+    m_mode(mode) {}
+
+void EncodedFileReader::prefetch(const fs::path& path) const {
+
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    // Starts asynchronous readahead of the whole file into the page cache.
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    ::close(fd);
+}
+
+bool EncodedFileReader::load(const fs::path& path, EncodedFile& file) const {
+
+    file.release();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info{};
+    bool loaded = ::fstat(fd, &info) == 0 && info.st_size > 0;
+
+    if (loaded) {
+        const size_t size = static_cast<size_t>(info.st_size);
+        loaded = m_mode == FileReadMode::MMAP ? mapInto(fd, size, file) : readInto(fd, size, file);
+    }
+
+    ::close(fd);
+
+    if (loaded) {
+        m_bytesRead.increment(file.size());
+        m_ioWaitMicros.increment(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+        ));
+    }
+
+    return loaded;
+}
+
+bool EncodedFileReader::readInto(int fd, size_t size, EncodedFile& file) const {
+
+    // One buffer per loading thread, grown to the largest file seen.
+    thread_local std::vector<uchar> buffer;
+    buffer.resize(size);
+
+    size_t offset = 0;
+    while (offset < size) {
+        const ssize_t n = ::read(fd, buffer.data() + offset, size - offset);
+        if (n <= 0) {
+            return false;
+        }
+        offset += static_cast<size_t>(n);
+    }
+
+    file.m_data = buffer.data();
+    file.m_size = size;
+    return true;
+}
+
+bool EncodedFileReader::mapInto(int fd, size_t size, EncodedFile& file) const {
+
+    // MAP_POPULATE faults every page in now, so the decoder never blocks on I/O.
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    file.m_mapping = mapping;
+    file.m_data = static_cast<const uchar*>(mapping);
+    file.m_size = size;
+    return true;
+}
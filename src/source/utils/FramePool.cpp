@@ -0,0 +1,40 @@
+#include "source/utils/FramePool.hpp"
+
+
+FramePool::FramePool(size_t capacity):
+    m_capacity(capacity) {
+
+    m_slots.reserve(capacity);
+}
+
+bool FramePool::isUnshared(const cv::Mat& slot) {
+    // The pool's own header holds one reference; OpenCV updates the count atomically.
+    return slot.u != nullptr && CV_XADD(&slot.u->refcount, 0) == 1;
+}
+
+cv::Mat FramePool::acquire(int rows, int cols, int type) {
+
+    if (m_capacity == 0) {
+        return cv::Mat(rows, cols, type);
+    }
+
+    // Round-robin scan so buffers are reused in roughly the order they were released.
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        const size_t slotIdx = (m_nextSlot + i) % m_slots.size();
+        cv::Mat& slot = m_slots[slotIdx];
+
+        if (isUnshared(slot)) {
+            slot.create(rows, cols, type);
+            m_nextSlot = (slotIdx + 1) % m_slots.size();
+            return slot;
+        }
+    }
+
+    if (m_slots.size() < m_capacity) {
+        m_slots.emplace_back(rows, cols, type);
+        return m_slots.back();
+    }
+
+    m_misses.increment();
+    return cv::Mat(rows, cols, type);
+}
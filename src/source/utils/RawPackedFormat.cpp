@@ -0,0 +1,73 @@
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "source/utils/RawPackedFormat.hpp"
+#include "source/interface/ImageFileFrameSource.hpp"
+
+
+size_t packImageFolder(const fs::path& folder, const fs::path& output, size_t height, size_t width) {
+
+    if (!fs::is_directory(folder)) {
+        throw std::runtime_error("Invalid folder to pack: " + folder.string());
+    }
+
+    const std::vector<fs::path> files = ImageFileFrameSource::listImageFiles(folder);
+
+    std::ofstream out(output, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Could not create packed file: " + output.string());
+    }
+
+    RawPackedHeader header{};
+    std::memcpy(header.magic, RAW_PACKED_MAGIC, sizeof(header.magic));
+    header.version = RAW_PACKED_VERSION;
+    header.channels = 3;
+    header.dataOffset = RAW_PACKED_DATA_OFFSET;
+
+    // The header is rewritten once the frame count and size are known.
+    out.seekp(static_cast<std::streamoff>(RAW_PACKED_DATA_OFFSET));
+
+    cv::Mat resized;
+    for (const fs::path& file : files) {
+
+        const cv::Mat image = cv::imread(file.string(), cv::IMREAD_COLOR);
+        if (image.empty()) {
+            continue;
+        }
+
+        if (height == 0 || width == 0) {
+            height = static_cast<size_t>(image.rows);
+            width = static_cast<size_t>(image.cols);
+        }
+
+        const cv::Mat* frame = &image;
+        if (static_cast<size_t>(image.rows) != height || static_cast<size_t>(image.cols) != width) {
+            cv::resize(image, resized, cv::Size(static_cast<int>(width), static_cast<int>(height)));
+            frame = &resized;
+        }
+
+        const cv::Mat continuous = frame->isContinuous() ? *frame : frame->clone();
+        out.write(reinterpret_cast<const char*>(continuous.data), static_cast<std::streamsize>(height * width * 3));
+        ++header.frameCount;
+    }
+
+    if (header.frameCount == 0) {
+        throw std::runtime_error("No readable image files in: " + folder.string());
+    }
+
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!out) {
+        throw std::runtime_error("Could not write packed file: " + output.string());
+    }
+
+    return static_cast<size_t>(header.frameCount);
+}
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "source/utils/SegmentedVideoDecoder.hpp"
+
+
+SegmentedVideoDecoder::SegmentedVideoDecoder(
+    const fs::path& videoPath,
+    size_t numDecoders,
+    size_t chunkFrames,
+    size_t beginFrame,
+    size_t endFrame,
+    size_t expectedFrames,
+    size_t imgHeight,
+    size_t imgWidth,
+    size_t framePoolSize,
+    std::function<bool(size_t)> keepFrame
+):
+    m_videoPath(videoPath),
+    m_numDecoders(numDecoders),
+    m_chunkFrames(chunkFrames),
+    m_beginFrame(beginFrame),
+    m_endFrame(endFrame),
+    m_expectedFrames(expectedFrames),
+    m_imgHeight(imgHeight),
+    m_imgWidth(imgWidth),
+    m_framePoolSize(framePoolSize),
+    m_keepFrame(std::move(keepFrame)),
+    m_chunks(numDecoders + 1) {
+
+    if (numDecoders < 2) {
+        throw std::runtime_error("Segmented video decoding needs at least 2 decoders.");
+    }
+    if (chunkFrames == 0) {
+        throw std::runtime_error("Segmented video decoding needs chunks of at least 1 frame.");
+    }
+
+    // Plan chunks over the frames the video reports; the last one runs to m_endFrame regardless.
+    const size_t plannedEnd = std::min(m_endFrame, m_expectedFrames);
+    m_numChunks = plannedEnd > m_beginFrame ? (plannedEnd - m_beginFrame + m_chunkFrames - 1) / m_chunkFrames : 1;
+
+    m_decoders.reserve(numDecoders);
+    for (size_t decoder = 0; decoder < numDecoders; ++decoder) {
+        m_decoders.emplace_back([this, decoder]() { decodeLoop(decoder); });
+    }
+}
+
+SegmentedVideoDecoder::~SegmentedVideoDecoder() {
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_chunkFree.notify_all();
+
+    for (std::thread& decoder : m_decoders) {
+        decoder.join();
+    }
+}
+
+void SegmentedVideoDecoder::decodeLoop(size_t decoder) {
+
+    cv::VideoCapture cap;
+    FramePool pool(m_framePoolSize);
+
+    for (size_t index = decoder; index < m_numChunks; index += m_numDecoders) {
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_chunkFree.wait(lock, [this, index]() { return m_stopping || index < m_readChunk + m_chunks.size(); });
+            if (m_stopping) {
+                return;
+            }
+        }
+
+        try {
+            if (!cap.isOpened() && !cap.open(m_videoPath.string())) {
+                throw std::runtime_error("Video could not be opened by a segment decoder: " + m_videoPath.string());
+            }
+            decodeChunk(cap, pool, index);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Chunk& chunk = chunkSlot(index);
+                chunk.error = std::current_exception();
+                chunk.done = true;
+            }
+            m_frameReady.notify_all();
+            return;
+        }
+    }
+}
+
+void SegmentedVideoDecoder::decodeChunk(cv::VideoCapture& cap, FramePool& pool, size_t index) {
+
+    const size_t begin = m_beginFrame + index * m_chunkFrames;
+    const size_t end = index + 1 == m_numChunks ? m_endFrame : begin + m_chunkFrames;
+
+    // Captures start at frame 0; any other chunk start needs a seek, which has to be exact
+    // for the merged stream to match a sequential decode.
+    bool ended = false;
+    bool seeked = false;
+    const size_t position = static_cast<size_t>(cap.get(cv::CAP_PROP_POS_FRAMES));
+    if (position != begin) {
+        m_seeks.increment();
+        seeked = true;
+        if (!cap.set(cv::CAP_PROP_POS_FRAMES, static_cast<double>(begin))) {
+            // Planned chunks start at frames the video reports, so a refused seek is a container
+            // that cannot seek, not the end of the stream. Should the stream really end earlier,
+            // next() stops at the chunk that ran out and never reaches this error.
+            if (begin < m_expectedFrames) {
+                throw inexactSeek(begin);
+            }
+            ended = true;
+        } else if (static_cast<size_t>(cap.get(cv::CAP_PROP_POS_FRAMES)) != begin) {
+            throw inexactSeek(begin);
+        }
+    }
+
+    for (size_t frameId = begin; frameId < end && !ended; ++frameId) {
+
+        if (!cap.grab()) {
+            ended = true;
+            break;
+        }
+        if (seeked) {
+            // FFmpeg reports POS_FRAMES from the seek target, so check the timestamp of the frame
+            // actually decoded; it has to lie within half a frame of the one planned.
+            seeked = false;
+            const double fps = cap.get(cv::CAP_PROP_FPS);
+            if (fps > 0.0 && std::abs(cap.get(cv::CAP_PROP_POS_MSEC) - 1e3 * frameId / fps) > 5e2 / fps) {
+                throw inexactSeek(frameId);
+            }
+        }
+        if (!m_keepFrame(frameId)) {
+            m_framesSkipped.increment();
+            continue;
+        }
+
+        cv::Mat image = pool.acquire(static_cast<int>(m_imgHeight), static_cast<int>(m_imgWidth), CV_8UC3);
+        if (!cap.retrieve(image)) {
+            ended = true;
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopping) {
+                return;
+            }
+            chunkSlot(index).frames.emplace_back(frameId, std::move(image));
+        }
+        m_frameReady.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Chunk& chunk = chunkSlot(index);
+        chunk.done = true;
+        chunk.endedEarly = ended;
+    }
+    m_frameReady.notify_all();
+}
+
+std::runtime_error SegmentedVideoDecoder::inexactSeek(size_t frameId) const {
+    return std::runtime_error(
+        "Could not seek exactly to frame " + std::to_string(frameId) + " of " + m_videoPath.string()
+        + "; decode this video with a single decoder."
+    );
+}
+
+bool SegmentedVideoDecoder::next(cv::Mat& image, size_t& frameId) {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_readChunk < m_numChunks) {
+
+        Chunk& chunk = chunkSlot(m_readChunk);
+        m_frameReady.wait(lock, [&chunk]() { return !chunk.frames.empty() || chunk.done; });
+
+        if (!chunk.frames.empty()) {
+            frameId = chunk.frames.front().first;
+            image = std::move(chunk.frames.front().second);
+            chunk.frames.pop_front();
+            return true;
+        }
+
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+        if (chunk.endedEarly) {
+            m_readChunk = m_numChunks;
+            break;
+        }
+
+        // Hand the slot to the chunk K + 1 ahead and wake its decoder.
+        chunk = Chunk();
+        ++m_readChunk;
+        m_chunkFree.notify_all();
+    }
+
+    return false;
+}
@@ -0,0 +1,180 @@
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "source/utils/SharedFrameRing.hpp"
+#include "source/interface/ImageFileFrameSource.hpp"
+
+
+SharedFrameRingProducer::SharedFrameRingProducer(
+    const std::string& name,
+    uint32_t slotCount,
+    uint32_t maxWidth,
+    uint32_t maxHeight
+):
+    m_name(name),
+    m_maxWidth(maxWidth),
+    m_maxHeight(maxHeight) {
+
+    if (slotCount == 0 || maxWidth == 0 || maxHeight == 0) {
+        throw std::runtime_error("Shared frame ring needs at least one slot and a non-zero frame size");
+    }
+
+    const size_t slotsOffset = (sizeof(SharedFrameRingHeader) + 63) / 64 * 64;
+    const size_t slotBytes = (SHARED_FRAME_PIXELS_OFFSET + size_t{maxWidth} * maxHeight * 3 + 63) / 64 * 64;
+    m_mappingSize = slotsOffset + slotBytes * slotCount;
+
+    const int fd = ::shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Could not create shared memory " + m_name + ": " + std::strerror(errno));
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(m_mappingSize)) != 0) {
+        ::close(fd);
+        ::shm_unlink(m_name.c_str());
+        throw std::runtime_error("Could not size shared memory " + m_name);
+    }
+
+    m_mapping = ::mmap(nullptr, m_mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (m_mapping == MAP_FAILED) {
+        m_mapping = nullptr;
+        ::shm_unlink(m_name.c_str());
+        throw std::runtime_error("Could not map shared memory " + m_name);
+    }
+
+    // Counters first; the consumer only trusts the header once the magic is present.
+    m_header = new (m_mapping) SharedFrameRingHeader{};
+    m_header->version = SHARED_FRAME_RING_VERSION;
+    m_header->slotCount = slotCount;
+    m_header->slotBytes = slotBytes;
+    m_header->slotsOffset = slotsOffset;
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(m_header->magic, SHARED_FRAME_RING_MAGIC, sizeof(m_header->magic));
+}
+
+SharedFrameRingProducer::~SharedFrameRingProducer() {
+    ::munmap(m_mapping, m_mappingSize);
+    ::shm_unlink(m_name.c_str());
+}
+
+bool SharedFrameRingProducer::publish(
+    const cv::Mat& image,
+    uint64_t frameId,
+    uint64_t timestampNs,
+    std::chrono::milliseconds timeout
+) {
+
+    if (image.type() != CV_8UC3 || static_cast<uint32_t>(image.cols) > m_maxWidth || static_cast<uint32_t>(image.rows) > m_maxHeight) {
+        throw std::runtime_error("Shared frame ring only takes CV_8UC3 images up to the configured size");
+    }
+
+    const uint64_t seq = m_header->writeSeq.load(std::memory_order_relaxed);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (seq - m_header->readSeq.load(std::memory_order_acquire) >= m_header->slotCount) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    uchar* slot = static_cast<uchar*>(m_mapping) + m_header->slotsOffset + (seq % m_header->slotCount) * m_header->slotBytes;
+
+    SharedFrameSlotHeader slotHeader{};
+    slotHeader.frameId = frameId;
+    slotHeader.timestampNs = timestampNs;
+    slotHeader.width = static_cast<uint32_t>(image.cols);
+    slotHeader.height = static_cast<uint32_t>(image.rows);
+    slotHeader.stride = static_cast<uint32_t>(image.cols * 3);
+    slotHeader.channels = 3;
+    std::memcpy(slot, &slotHeader, sizeof(slotHeader));
+
+    cv::Mat pixels(image.rows, image.cols, CV_8UC3, slot + SHARED_FRAME_PIXELS_OFFSET, slotHeader.stride);
+    image.copyTo(pixels);
+
+    m_header->writeSeq.store(seq + 1, std::memory_order_release);
+    return true;
+}
+
+void SharedFrameRingProducer::close() {
+    m_header->closed.store(1, std::memory_order_release);
+}
+
+bool SharedFrameRingProducer::waitUntilDrained(std::chrono::milliseconds timeout) const {
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (m_header->readSeq.load(std::memory_order_acquire) < m_header->writeSeq.load(std::memory_order_relaxed)) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+size_t publishImageFolder(const std::string& ringName, const fs::path& folder, uint32_t slotCount) {
+
+    if (!fs::is_directory(folder)) {
+        throw std::runtime_error("Invalid folder to publish: " + folder.string());
+    }
+
+    const std::vector<fs::path> files = ImageFileFrameSource::listImageFiles(folder);
+    const std::chrono::seconds stallTimeout(60);
+
+    std::unique_ptr<SharedFrameRingProducer> producer;
+    cv::Size frameSize;
+    cv::Mat resized;
+    size_t published = 0;
+
+    for (const fs::path& file : files) {
+
+        const cv::Mat image = cv::imread(file.string(), cv::IMREAD_COLOR);
+        if (image.empty()) {
+            continue;
+        }
+
+        if (!producer) {
+            frameSize = cv::Size(image.cols, image.rows);
+            producer = std::make_unique<SharedFrameRingProducer>(
+                ringName, slotCount, static_cast<uint32_t>(image.cols), static_cast<uint32_t>(image.rows)
+            );
+        }
+
+        const cv::Mat* frame = &image;
+        if (image.cols != frameSize.width || image.rows != frameSize.height) {
+            cv::resize(image, resized, frameSize);
+            frame = &resized;
+        }
+
+        const uint64_t timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+
+        if (!producer->publish(*frame, published, timestampNs, stallTimeout)) {
+            throw std::runtime_error("Consumer of " + ringName + " stopped releasing frames");
+        }
+        ++published;
+    }
+
+    if (!producer) {
+        throw std::runtime_error("No readable image files in: " + folder.string());
+    }
+
+    producer->close();
+    if (!producer->waitUntilDrained(stallTimeout)) {
+        throw std::runtime_error("Consumer of " + ringName + " did not drain the ring");
+    }
+    return published;
+}
@@ -0,0 +1,148 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <set>
+
+#include "source/interface/FrameSource.hpp"
+
+namespace {
+
+Counter& framePoolMisses() {
+    // Same name and help as FramePool, so the registry hands back its counter.
+    return MetricsRegistry::global().counter(
+        "yoloseg_source_frame_pool_misses_total", "Frames allocated outside the frame pool because every slot was in use."
+    );
+}
+
+/**
+ * @brief Source of `numFrames` pooled frames, padded with zero frames up to a full batch.
+ */
+class CountingFrameSource : public FrameSource {
+
+    public:
+        CountingFrameSource(size_t numFrames, size_t batchSize, size_t framePoolSize):
+            FrameSource(4, 6, batchSize, framePoolSize),
+            m_numFrames(numFrames) {}
+
+        using FrameSource::zeros;
+
+        bool read(Frame& frame, BaseLogger& logger) override {
+            (void)logger;
+
+            if (m_nextFrame < m_numFrames) {
+                frame.image = m_framePool.acquire(
+                    static_cast<int>(m_imgHeight), static_cast<int>(m_imgWidth), CV_8UC3
+                );
+                frame.image.setTo(cv::Scalar::all(static_cast<double>(m_nextFrame % 256)));
+                frame.metadata.frameId = m_nextFrame;
+                frame.metadata.isPadding = false;
+            } else if (m_nextFrame % m_batchSize != 0) {
+                frame.image = zeros();
+                frame.metadata.frameId = m_nextFrame;
+                frame.metadata.isPadding = true;
+            } else {
+                return false;
+            }
+
+            ++m_nextFrame;
+            return true;
+        }
+
+    private:
+        size_t m_numFrames;
+        size_t m_nextFrame = 0;
+};
+
+BaseLogger& testLogger() {
+    static BaseLogger logger(std::filesystem::temp_directory_path() / "frame_source_tests.log");
+    return logger;
+}
+
+} // namespace
+
+
+TEST_CASE("FramePool hands a slot back once outside references are dropped") {
+    FramePool pool(1);
+
+    cv::Mat first = pool.acquire(8, 8, CV_8UC3);
+    const uchar* firstData = first.data;
+    first.release();
+
+    cv::Mat second = pool.acquire(8, 8, CV_8UC3);
+    CHECK(second.data == firstData);
+
+    // A copied header keeps the slot in use, so the same buffer is not handed out twice.
+    cv::Mat copy = second;
+    second.release();
+    cv::Mat third = pool.acquire(8, 8, CV_8UC3);
+    CHECK(third.data != firstData);
+}
+
+TEST_CASE("FramePool counts a miss when every slot is held") {
+    FramePool pool(2);
+    Counter& misses = framePoolMisses();
+
+    const uint64_t before = misses.value();
+    cv::Mat a = pool.acquire(8, 8, CV_8UC3);
+    cv::Mat b = pool.acquire(8, 8, CV_8UC3);
+    CHECK(misses.value() == before);
+
+    cv::Mat c = pool.acquire(8, 8, CV_8UC3);
+    CHECK(misses.value() == before + 1);
+    CHECK(c.data != a.data);
+    CHECK(c.data != b.data);
+
+    // A capacity of 0 disables pooling without counting misses.
+    FramePool disabled(0);
+    cv::Mat d = disabled.acquire(8, 8, CV_8UC3);
+    CHECK(misses.value() == before + 1);
+}
+
+TEST_CASE("FrameSource::zeros returns one shared zero buffer") {
+    CountingFrameSource source(0, 1, 0);
+
+    cv::Mat first = source.zeros();
+    cv::Mat second = source.zeros();
+
+    CHECK(first.data == second.data);
+    CHECK(first.rows == 4);
+    CHECK(first.cols == 6);
+    CHECK(first.type() == CV_8UC3);
+    CHECK(cv::countNonZero(first.reshape(1)) == 0);
+}
+
+TEST_CASE("readBatch recycles pooled frame buffers across batches") {
+    constexpr size_t batchSize = 4;
+    constexpr size_t numBatches = 5;
+
+    // One slot beyond the batch: the first read of a batch happens while the previous batch is still held.
+    CountingFrameSource source(batchSize * numBatches - 1, batchSize, batchSize + 1);
+    BatchFrameData batch;
+    Counter& misses = framePoolMisses();
+
+    const uint64_t before = misses.value();
+    std::set<const uchar*> buffers;
+    const uchar* paddingBuffer = source.zeros().data;
+
+    for (size_t batchIdx = 0; batchIdx < numBatches; ++batchIdx) {
+        REQUIRE(source.readBatch(batch, testLogger()));
+        REQUIRE(batch.images.size() == batchSize);
+
+        for (size_t i = 0; i < batchSize; ++i) {
+            const FrameMetadata& meta = batch.metas[i];
+            CHECK(meta.frameId == batchIdx * batchSize + i);
+
+            if (meta.isPadding) {
+                CHECK(batch.images[i].data == paddingBuffer);
+            } else {
+                CHECK(static_cast<uint64_t>(batch.images[i].at<cv::Vec3b>(0, 0)[0]) == meta.frameId % 256);
+                buffers.insert(batch.images[i].data);
+            }
+        }
+    }
+
+    CHECK(buffers.size() == batchSize + 1);
+    CHECK(misses.value() == before);
+    CHECK_FALSE(source.readBatch(batch, testLogger()));
+}
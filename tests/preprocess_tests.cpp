@@ -0,0 +1,480 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <opencv2/dnn.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "post_process/utils/PostProcessUtils.hpp"
+#include "pre_process/utils/PreProcessUtils.hpp"
+
+namespace {
+
+/**
+ * @brief Runs `check` on the AVX2/F16C kernels, when the host has them, and on the scalar fallback.
+ */
+void forEachKernelPath(const std::function<void()>& check) {
+
+    setPreProcessAvx2Enabled(true);
+    if (preProcessAvx2Active()) {
+        INFO("AVX2 path");
+        check();
+    }
+
+    setPreProcessAvx2Enabled(false);
+    {
+        INFO("scalar path");
+        check();
+    }
+    setPreProcessAvx2Enabled(true);
+}
+
+/**
+ * @brief Random CV_8UC3 image, optionally a view into wider rows so its stride exceeds its width.
+ */
+cv::Mat randomImage(int rows, int cols, int rowPadding, uint64_t seed) {
+    cv::Mat padded(rows, cols + rowPadding, CV_8UC3);
+    cv::RNG rng(seed);
+    rng.fill(padded, cv::RNG::UNIFORM, cv::Scalar::all(0), cv::Scalar::all(256));
+    return padded(cv::Rect(0, 0, cols, rows));
+}
+
+template <typename T>
+TensorView hostTensor(std::vector<T>& storage, DataType type, const std::vector<size_t>& dims) {
+    TensorView view;
+    view.data = storage.data();
+    view.type = type;
+    view.numElements = storage.size();
+    view.totalBytes = storage.size() * sizeof(T);
+    view.shape.dims = dims;
+    view.mode = IOMode::Input;
+    view.device = DeviceType::CPU;
+    return view;
+}
+
+template <typename T>
+bool sameBytes(const std::vector<T>& actual, const cv::Mat& expected) {
+    return expected.isContinuous() &&
+        expected.total() * expected.elemSize() == actual.size() * sizeof(T) &&
+        std::memcmp(actual.data(), expected.data, actual.size() * sizeof(T)) == 0;
+}
+
+struct BlobCase {
+    int srcRows, srcCols, rowPadding;
+    int height, width;
+    bool swapRB;
+};
+
+} // namespace
+
+
+TEST_CASE("createBlob4D matches blobFromImages for FP32, FP16 and UInt8") {
+
+    const BlobCase cases[] = {
+        {48, 64, 0, 48, 64, false},   // already at the input size
+        {48, 64, 5, 48, 64, true},    // padded rows
+        {37, 53, 0, 32, 48, true},    // resized
+        {30, 45, 7, 30, 45, false},   // odd width, padded rows
+        {40, 61, 3, 21, 35, true},    // resized to an odd width
+    };
+    const std::array<std::array<float, 3>, 2> channelMeans = {{
+        {0.0f, 0.0f, 0.0f},
+        {103.53f, 116.28f, 123.675f},
+    }};
+    const float scales[] = {1.0f / 255.0f, 0.017f};
+
+    for (const BlobCase& c : cases) {
+        CAPTURE(c.srcRows);
+        CAPTURE(c.srcCols);
+        CAPTURE(c.rowPadding);
+        CAPTURE(c.width);
+        CAPTURE(c.swapRB);
+
+        const std::vector<cv::Mat> images = {
+            randomImage(c.srcRows, c.srcCols, c.rowPadding, 1),
+            randomImage(c.srcRows, c.srcCols, c.rowPadding, 2),
+        };
+        const std::vector<size_t> dims = {images.size(), 3, static_cast<size_t>(c.height), static_cast<size_t>(c.width)};
+        const size_t elems = images.size() * 3 * c.height * c.width;
+
+        for (size_t m = 0; m < channelMeans.size(); ++m) {
+            const std::array<float, 3>& means = channelMeans[m];
+            const float scale = scales[m];
+
+            cv::Mat expected32, expected16;
+            cv::dnn::blobFromImages(
+                images, expected32, scale, cv::Size(c.width, c.height),
+                cv::Scalar(means[0], means[1], means[2]), c.swapRB, false, CV_32F
+            );
+            expected32.convertTo(expected16, CV_16F);
+
+            forEachKernelPath([&]() {
+                std::vector<float> actual32(elems);
+                TensorView view32 = hostTensor(actual32, DataType::Float32, dims);
+                createBlob4D<float>(
+                    images, static_cast<int>(images.size()), 3, c.height, c.width,
+                    means, scale, c.swapRB, {}, 0.0f, view32
+                );
+                CHECK(sameBytes(actual32, expected32));
+
+                std::vector<cv::float16_t> actual16(elems);
+                TensorView view16 = hostTensor(actual16, DataType::Float16, dims);
+                createBlob4D<cv::float16_t>(
+                    images, static_cast<int>(images.size()), 3, c.height, c.width,
+                    means, scale, c.swapRB, {}, 0.0f, view16
+                );
+                CHECK(sameBytes(actual16, expected16));
+            });
+        }
+
+        // 8-bit output leaves normalization to the model: zero means, scale 1.
+        cv::Mat expected8;
+        cv::dnn::blobFromImages(
+            images, expected8, 1.0, cv::Size(c.width, c.height),
+            cv::Scalar(), c.swapRB, false, CV_8U
+        );
+
+        forEachKernelPath([&]() {
+            std::vector<uint8_t> actual8(elems);
+            TensorView view8 = hostTensor(actual8, DataType::UInt8, dims);
+            createBlob4D<uint8_t>(
+                images, static_cast<int>(images.size()), 3, c.height, c.width,
+                {0.0f, 0.0f, 0.0f}, 1.0f, c.swapRB, {}, 0.0f, view8
+            );
+            CHECK(sameBytes(actual8, expected8));
+        });
+    }
+}
+
+TEST_CASE("createBlob4D letterboxes like blobFromImages of a copyMakeBorder image") {
+
+    const int height = 31;
+    const int width = 45;
+    const float padValue = 114.0f;
+    const std::array<float, 3> means = {103.53f, 116.28f, 123.675f};
+    const float scale = 0.017f;
+
+    // Tall and wide sources, both with an odd border, the tall one with padded rows.
+    const std::vector<cv::Mat> images = {
+        randomImage(45, 41, 3, 8),
+        randomImage(37, 53, 0, 9),
+    };
+    std::vector<Letterbox> letterboxes;
+    std::vector<cv::Mat> padded;
+    for (const cv::Mat& image : images) {
+        const Letterbox lb = computeLetterbox(image.cols, image.rows, width, height);
+        cv::Mat resized, bordered;
+        cv::resize(image, resized, cv::Size(lb.width, lb.height), 0, 0, cv::INTER_LINEAR);
+        cv::copyMakeBorder(
+            resized, bordered,
+            lb.y, height - lb.y - lb.height, lb.x, width - lb.x - lb.width,
+            cv::BORDER_CONSTANT, cv::Scalar::all(padValue)
+        );
+        letterboxes.push_back(lb);
+        padded.push_back(bordered);
+    }
+
+    cv::Mat expected32, expected16;
+    cv::dnn::blobFromImages(
+        padded, expected32, scale, cv::Size(width, height),
+        cv::Scalar(means[0], means[1], means[2]), true, false, CV_32F
+    );
+    expected32.convertTo(expected16, CV_16F);
+
+    const std::vector<size_t> dims = {images.size(), 3, static_cast<size_t>(height), static_cast<size_t>(width)};
+    const size_t elems = images.size() * 3 * height * width;
+
+    forEachKernelPath([&]() {
+        std::vector<float> actual32(elems);
+        TensorView view32 = hostTensor(actual32, DataType::Float32, dims);
+        createBlob4D<float>(
+            images, static_cast<int>(images.size()), 3, height, width,
+            means, scale, true, letterboxes, padValue, view32
+        );
+        CHECK(sameBytes(actual32, expected32));
+
+        std::vector<cv::float16_t> actual16(elems);
+        TensorView view16 = hostTensor(actual16, DataType::Float16, dims);
+        createBlob4D<cv::float16_t>(
+            images, static_cast<int>(images.size()), 3, height, width,
+            means, scale, true, letterboxes, padValue, view16
+        );
+        CHECK(sameBytes(actual16, expected16));
+    });
+}
+
+TEST_CASE("computeLetterbox puts the extra pixel of an odd border on the right or bottom") {
+
+    // 41x45 scales by 32/45 to 29x32 in 48x32: 19 columns of border.
+    const Letterbox tall = computeLetterbox(41, 45, 48, 32);
+    CHECK(tall.width == 29);
+    CHECK(tall.height == 32);
+    CHECK(tall.x == 9);
+    CHECK(48 - tall.x - tall.width == 10);
+    CHECK(tall.y == 0);
+
+    // 64x33 keeps its size in 64x64: 31 rows of border.
+    const Letterbox wide = computeLetterbox(64, 33, 64, 64);
+    CHECK(wide.scale == 1.0);
+    CHECK(wide.width == 64);
+    CHECK(wide.height == 33);
+    CHECK(wide.x == 0);
+    CHECK(wide.y == 15);
+    CHECK(64 - wide.y - wide.height == 16);
+}
+
+TEST_CASE("unletterboxDetectionInPlace maps network input boxes back onto the frame") {
+
+    const size_t frameW = 200;
+    const size_t frameH = 100;
+    const size_t inputW = 64;
+    const size_t inputH = 64;
+    const Letterbox lb = computeLetterbox(frameW, frameH, inputW, inputH);
+    REQUIRE(lb.y > 0);
+
+    FrameMetadata metadata;
+    metadata.inputWidth = inputW;
+    metadata.inputHeight = inputH;
+    metadata.isLetterboxed = true;
+    metadata.letterboxScale = lb.scale;
+    metadata.letterboxPadX = static_cast<size_t>(lb.x);
+    metadata.letterboxPadY = static_cast<size_t>(lb.y);
+    metadata.letterboxWidth = static_cast<size_t>(lb.width);
+    metadata.letterboxHeight = static_cast<size_t>(lb.height);
+
+    // A frame-normalized point as the network sees it, normalized to the input.
+    const auto toInput = [&](double x, double y) {
+        return cv::Point2d(
+            (lb.x + x * lb.width) / static_cast<double>(inputW),
+            (lb.y + y * lb.height) / static_cast<double>(inputH)
+        );
+    };
+
+    SUBCASE("inside the image") {
+        const cv::Point2d topLeft = toInput(0.25, 0.2);
+        const cv::Point2d bottomRight = toInput(0.75, 0.6);
+
+        Detection detection;
+        detection.isNormalized = true;
+        detection.boundingBox = cv::Rect2d(topLeft, bottomRight);
+        detection.objectContour = {topLeft, toInput(0.5, 0.4), bottomRight};
+
+        REQUIRE(unletterboxDetectionInPlace(detection, metadata));
+        CHECK(detection.boundingBox.x == doctest::Approx(0.25));
+        CHECK(detection.boundingBox.y == doctest::Approx(0.2));
+        CHECK(detection.boundingBox.width == doctest::Approx(0.5));
+        CHECK(detection.boundingBox.height == doctest::Approx(0.4));
+        REQUIRE(detection.objectContour.size() == 3);
+        CHECK(detection.objectContour[1].x == doctest::Approx(0.5));
+        CHECK(detection.objectContour[1].y == doctest::Approx(0.4));
+    }
+
+    SUBCASE("on the border") {
+        // From the top border, above the image, to the bottom border, below it.
+        const double top = 0.5 * lb.y / inputH;
+        const double bottom = 1.0 - 0.5 * (inputH - lb.y - lb.height) / inputH;
+
+        Detection detection;
+        detection.isNormalized = true;
+        detection.boundingBox = cv::Rect2d(cv::Point2d(0.0, top), cv::Point2d(1.0, bottom));
+        detection.objectContour = {cv::Point2d(0.5, top), cv::Point2d(0.5, bottom)};
+
+        REQUIRE(unletterboxDetectionInPlace(detection, metadata));
+        CHECK(detection.boundingBox.x == doctest::Approx(0.0));
+        CHECK(detection.boundingBox.y == doctest::Approx(0.0));
+        CHECK(detection.boundingBox.width == doctest::Approx(1.0));
+        CHECK(detection.boundingBox.height == doctest::Approx(1.0));
+        CHECK(detection.objectContour[0].y == doctest::Approx(0.0));
+        CHECK(detection.objectContour[1].y == doctest::Approx(1.0));
+    }
+
+    SUBCASE("not letterboxed or not normalized") {
+        Detection detection;
+        detection.isNormalized = false;
+        CHECK_FALSE(unletterboxDetectionInPlace(detection, metadata));
+
+        detection.isNormalized = true;
+        metadata.isLetterboxed = false;
+        CHECK_FALSE(unletterboxDetectionInPlace(detection, metadata));
+    }
+}
+
+TEST_CASE("createInterleavedBlob4D matches cvtColor") {
+
+    // The AVX2 swap stores 16 bytes per 15-byte step, so narrow rows and
+    // widths that are not a multiple of 5 pixels exercise the scalar tail.
+    for (int width : {1, 5, 6, 10, 21}) {
+        for (bool swapRB : {false, true}) {
+            CAPTURE(width);
+            CAPTURE(swapRB);
+
+            const int height = 3;
+            const std::vector<cv::Mat> images = {randomImage(height, width, 4, 3)};
+
+            cv::Mat expected;
+            if (swapRB) {
+                cv::cvtColor(images[0], expected, cv::COLOR_BGR2RGB);
+            } else {
+                expected = images[0].clone();
+            }
+
+            forEachKernelPath([&]() {
+                std::vector<uint8_t> actual(static_cast<size_t>(height) * width * 3);
+                TensorView view = hostTensor(actual, DataType::UInt8, {1, static_cast<size_t>(height), static_cast<size_t>(width), 3});
+                createInterleavedBlob4D(images, 1, height, width, swapRB, {}, 0, view);
+                CHECK(sameBytes(actual, expected));
+            });
+        }
+    }
+}
+
+TEST_CASE("createInterleavedBlob4D letterboxes like copyMakeBorder") {
+
+    const int height = 32;
+    const int width = 48;
+    const uint8_t padValue = 114;
+    const std::vector<cv::Mat> images = {randomImage(45, 41, 0, 4)};
+    const std::vector<Letterbox> letterboxes = {computeLetterbox(images[0].cols, images[0].rows, width, height)};
+    const Letterbox& lb = letterboxes[0];
+
+    cv::Mat resized, swapped, expected;
+    cv::resize(images[0], resized, cv::Size(lb.width, lb.height), 0, 0, cv::INTER_LINEAR);
+    cv::cvtColor(resized, swapped, cv::COLOR_BGR2RGB);
+    cv::copyMakeBorder(
+        swapped, expected,
+        lb.y, height - lb.y - lb.height, lb.x, width - lb.x - lb.width,
+        cv::BORDER_CONSTANT, cv::Scalar::all(padValue)
+    );
+
+    forEachKernelPath([&]() {
+        std::vector<uint8_t> actual(static_cast<size_t>(height) * width * 3);
+        TensorView view = hostTensor(actual, DataType::UInt8, {1, static_cast<size_t>(height), static_cast<size_t>(width), 3});
+        createInterleavedBlob4D(images, 1, height, width, true, letterboxes, padValue, view);
+        CHECK(sameBytes(actual, expected));
+    });
+}
+
+namespace {
+
+/**
+ * @brief Gray pixel value and the INT8 value hand-computed for it.
+ */
+struct QuantizedPixel {
+    uint8_t pixel;
+    int8_t expected;
+};
+
+/**
+ * @brief Quantizes a one-row gray image and checks every plane against the hand-computed values.
+ *
+ * Rows of 19 pixels take one 16-pixel AVX2 step and a 3-pixel scalar tail.
+ */
+void checkQuantizedRow(
+    const std::vector<QuantizedPixel>& row,
+    float channelMean,
+    const Quantization& quantization
+) {
+    const int width = static_cast<int>(row.size());
+    cv::Mat image(1, width, CV_8UC3);
+    for (int x = 0; x < width; ++x) {
+        for (int c = 0; c < 3; ++c) {
+            image.ptr<uchar>(0)[3 * x + c] = row[x].pixel;
+        }
+    }
+
+    forEachKernelPath([&]() {
+        std::vector<int8_t> actual(3 * row.size());
+        fillBlobImage(
+            image, 1, width, nullptr, 0.0f, {channelMean, channelMean, channelMean}, 1.0f, true,
+            quantization, actual.data()
+        );
+
+        for (size_t c = 0; c < 3; ++c) {
+            for (size_t x = 0; x < row.size(); ++x) {
+                CAPTURE(c);
+                CAPTURE(static_cast<int>(row[x].pixel));
+                CHECK(static_cast<int>(actual[c * row.size() + x]) == static_cast<int>(row[x].expected));
+            }
+        }
+    });
+}
+
+} // namespace
+
+
+TEST_CASE("INT8 output rounds halves to even around a non-zero zero point") {
+
+    // q = round((pixel - 10) / 2) - 100
+    checkQuantizedRow({
+        {5, -102}, {7, -102}, {9, -100}, {11, -100},      // -2.5, -1.5, -0.5, 0.5
+        {13, -98}, {15, -98}, {10, -100}, {0, -105},      // 1.5, 2.5, 0, -5
+        {20, -95}, {21, -94}, {23, -94}, {100, -55},      // 5, 5.5, 6.5, 45
+        {101, -54}, {103, -54}, {255, 22}, {254, 22},     // 45.5, 46.5, 122.5, 122
+        {17, -96}, {19, -96}, {250, 20},                  // 3.5, 4.5, 120
+    }, 10.0f, Quantization{2.0f, -100});
+}
+
+TEST_CASE("INT8 output saturates at -128 and 127") {
+
+    // q = (pixel - 128) / 0.5 + 10 = 2 * pixel - 246
+    checkQuantizedRow({
+        {0, -128}, {58, -128}, {59, -128}, {60, -126},
+        {64, -118}, {123, 0}, {128, 10}, {186, 126},
+        {187, 127}, {255, 127}, {1, -128}, {200, 127},
+        {150, 54}, {120, -6}, {100, -46}, {190, 127},
+        {2, -128}, {186, 126}, {254, 127},
+    }, 128.0f, Quantization{0.5f, 10});
+}
+
+TEST_CASE("INT8 output is the same on the AVX2 and scalar paths") {
+
+    const std::vector<cv::Mat> images = {
+        randomImage(37, 53, 5, 5),
+        randomImage(37, 53, 5, 6),
+    };
+    const int height = 31;
+    const int width = 45;
+    const std::vector<size_t> dims = {images.size(), 3, static_cast<size_t>(height), static_cast<size_t>(width)};
+    const size_t elems = images.size() * 3 * height * width;
+    const std::array<float, 3> means = {103.53f, 116.28f, 123.675f};
+    const std::vector<Letterbox> letterboxes = {
+        computeLetterbox(images[0].cols, images[0].rows, width, height),
+        computeLetterbox(images[1].cols, images[1].rows, width, height),
+    };
+    const Quantization quantization{0.0186f, -3};
+
+    std::vector<std::vector<int8_t>> outputs;
+    forEachKernelPath([&]() {
+        std::vector<int8_t> actual(elems);
+        TensorView view = hostTensor(actual, DataType::Int8, dims);
+        createBlob4D<int8_t>(
+            images, static_cast<int>(images.size()), 3, height, width,
+            means, 0.017f, true, letterboxes, 114.0f, view, nullptr, quantization
+        );
+        outputs.push_back(std::move(actual));
+    });
+
+    for (size_t i = 1; i < outputs.size(); ++i) {
+        CHECK(outputs[i] == outputs[0]);
+    }
+}
+
+TEST_CASE("INT8 output rejects invalid quantization") {
+
+    const cv::Mat image = randomImage(4, 4, 0, 7);
+    std::vector<int8_t> out(3 * 4 * 4);
+    const std::array<float, 3> means = {0.0f, 0.0f, 0.0f};
+
+    CHECK_THROWS_AS(
+        fillBlobImage(image, 4, 4, nullptr, 0.0f, means, 1.0f, false, Quantization{0.0f, 0}, out.data()),
+        std::runtime_error
+    );
+    CHECK_THROWS_AS(
+        fillBlobImage(image, 4, 4, nullptr, 0.0f, means, 1.0f, false, Quantization{1.0f, 128}, out.data()),
+        std::runtime_error
+    );
+}
@@ -0,0 +1,172 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "source/modes/VideoFrameSource.hpp"
+
+namespace {
+
+constexpr int CLIP_WIDTH = 96;
+constexpr int CLIP_HEIGHT = 64;
+constexpr int CLIP_FRAMES = 60;
+constexpr double CLIP_FPS = 30.0;
+
+/**
+ * @brief Short clip whose frames all differ, or an empty path when no encoder is available.
+ *
+ * MPEG-4 Part 2 has inter frames, so chunk seeks decode forward from a keyframe;
+ * Motion JPEG is the fallback every OpenCV build can write.
+ */
+fs::path writeTestClip() {
+
+    const fs::path dir = fs::temp_directory_path();
+    const std::vector<std::pair<std::string, int>> encoders = {
+        {"video_source_tests.mp4", cv::VideoWriter::fourcc('m', 'p', '4', 'v')},
+        {"video_source_tests.avi", cv::VideoWriter::fourcc('M', 'J', 'P', 'G')},
+    };
+
+    for (const auto& [name, fourcc] : encoders) {
+        const fs::path path = dir / name;
+        cv::VideoWriter writer(path.string(), fourcc, CLIP_FPS, cv::Size(CLIP_WIDTH, CLIP_HEIGHT));
+        if (!writer.isOpened()) {
+            continue;
+        }
+
+        for (int i = 0; i < CLIP_FRAMES; ++i) {
+            cv::Mat frame(CLIP_HEIGHT, CLIP_WIDTH, CV_8UC3, cv::Scalar(40, 80, 120));
+            cv::rectangle(frame, cv::Rect(i % (CLIP_WIDTH - 16), (3 * i) % (CLIP_HEIGHT - 16), 16, 16),
+                          cv::Scalar(255, 255 - 4 * i, 4 * i), cv::FILLED);
+            writer.write(frame);
+        }
+        return path;
+    }
+    return {};
+}
+
+FrameSourceConfig videoConfig(const fs::path& path) {
+    FrameSourceConfig config;
+    config.frameSourceType = FrameSourceType::VIDEO;
+    config.sourcePath = path;
+    config.imgHeight = CLIP_HEIGHT;
+    config.imgWidth = CLIP_WIDTH;
+    config.batchSize = 4;
+    return config;
+}
+
+/**
+ * @brief Every frame a source yields, with its metadata; images are cloned out of the batches.
+ */
+std::vector<Frame> readAll(const FrameSourceConfig& config, BaseLogger& logger) {
+
+    VideoFrameSource source(config);
+    BatchFrameData batch;
+    std::vector<Frame> frames;
+
+    while (source.readBatch(batch, logger)) {
+        for (size_t i = 0; i < batch.images.size(); ++i) {
+            frames.push_back(Frame{batch.images[i].clone(), batch.metas[i]});
+        }
+    }
+    return frames;
+}
+
+void checkSameStream(const std::vector<Frame>& sequential, const std::vector<Frame>& segmented) {
+
+    REQUIRE(segmented.size() == sequential.size());
+
+    for (size_t i = 0; i < sequential.size(); ++i) {
+        CAPTURE(i);
+        CHECK(segmented[i].metadata.frameId == sequential[i].metadata.frameId);
+        CHECK(segmented[i].metadata.isPadding == sequential[i].metadata.isPadding);
+        CHECK(segmented[i].metadata.timestampNs == sequential[i].metadata.timestampNs);
+        REQUIRE(segmented[i].image.size() == sequential[i].image.size());
+        CHECK(cv::norm(segmented[i].image, sequential[i].image, cv::NORM_INF) == 0.0);
+    }
+}
+
+BaseLogger& testLogger() {
+    static BaseLogger logger(fs::temp_directory_path() / "video_source_tests.log");
+    return logger;
+}
+
+} // namespace
+
+
+TEST_CASE("Segmented decoding yields the sequential stream") {
+
+    const fs::path clip = writeTestClip();
+    if (clip.empty()) {
+        MESSAGE("No video encoder available; skipping.");
+        return;
+    }
+
+    FrameSourceConfig sequentialConfig = videoConfig(clip);
+
+    SUBCASE("every frame") {}
+    SUBCASE("strided") {
+        sequentialConfig.videoFrameStride = 3;
+    }
+    SUBCASE("time range and target rate") {
+        sequentialConfig.videoStartMs = 250;
+        sequentialConfig.videoEndMs = 1800;
+        sequentialConfig.videoTargetFps = 7.0;
+    }
+
+    const std::vector<Frame> sequential = readAll(sequentialConfig, testLogger());
+    REQUIRE_FALSE(sequential.empty());
+
+    // Chunks that do not align with the stride or the batches, and more chunks than decoders.
+    for (size_t segments : {2, 3}) {
+        CAPTURE(segments);
+        FrameSourceConfig segmentedConfig = sequentialConfig;
+        segmentedConfig.videoDecodeSegments = segments;
+        segmentedConfig.videoSegmentFrames = 7;
+
+        checkSameStream(sequential, readAll(segmentedConfig, testLogger()));
+    }
+}
+
+TEST_CASE("Segmented decoding ends with the stream when the frame count is misreported") {
+
+    const fs::path clip = writeTestClip();
+    if (clip.empty()) {
+        MESSAGE("No video encoder available; skipping.");
+        return;
+    }
+
+    std::vector<Frame> sequential = readAll(videoConfig(clip), testLogger());
+    while (!sequential.empty() && sequential.back().metadata.isPadding) {
+        sequential.pop_back();
+    }
+    REQUIRE(sequential.size() == static_cast<size_t>(CLIP_FRAMES));
+
+    // Overestimated, chunks past the real end are planned; their seeks may fail, but the stream
+    // has to end in the chunk that runs out of frames. Underestimated, the open-ended last chunk
+    // has to decode past the reported count.
+    for (size_t expectedFrames : {static_cast<size_t>(CLIP_FRAMES + 20), static_cast<size_t>(CLIP_FRAMES - 20)}) {
+        CAPTURE(expectedFrames);
+
+        SegmentedVideoDecoder decoder(
+            clip, 3, 7, 0, std::numeric_limits<size_t>::max(), expectedFrames,
+            CLIP_HEIGHT, CLIP_WIDTH, 0, [](size_t) { return true; }
+        );
+
+        cv::Mat image;
+        size_t frameId = 0;
+        size_t numFrames = 0;
+        while (decoder.next(image, frameId)) {
+            REQUIRE(numFrames < sequential.size());
+            CHECK(frameId == sequential[numFrames].metadata.frameId);
+            CHECK(cv::norm(image, sequential[numFrames].image, cv::NORM_INF) == 0.0);
+            ++numFrames;
+        }
+        CHECK(numFrames == sequential.size());
+    }
+}